@@ -0,0 +1,185 @@
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Compares benchmark results against a stored baseline.
+//
+//   compare_results <baseline.json> <result.json>... [--threshold PERCENT]
+//       Fails (exit code 1) when a workload's ops_per_second dropped by
+//       more than PERCENT (default 10) compared to the baseline, or when a
+//       workload in the baseline has no result.
+//
+//   compare_results --merge <baseline.json> <result.json>...
+//       Writes the results into a new baseline file.
+//
+// Both files hold the flat objects written by e2e_benchmarks; a baseline
+// is simply a JSON array of them. Nothing else needs to be understood,
+// so a small scanner is used instead of a JSON library.
+
+struct Result {
+    std::string workload;
+    std::string json;      // the original object, for --merge
+    double opsPerSecond = 0.0;
+};
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Cannot read " << path << "\n";
+        std::exit(2);
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    return buffer.str();
+}
+
+// Value of "key" inside one flat object, as raw text (quotes stripped)
+std::string field(const std::string& object, const std::string& key) {
+    std::size_t pos = object.find("\"" + key + "\"");
+    if (pos == std::string::npos) {
+        return {};
+    }
+    pos = object.find(':', pos);
+    if (pos == std::string::npos) {
+        return {};
+    }
+    pos = object.find_first_not_of(" \t\r\n", pos + 1);
+    if (pos == std::string::npos) {
+        return {};
+    }
+    if (object[pos] == '"') {
+        std::size_t end = object.find('"', pos + 1);
+        return object.substr(pos + 1, end - pos - 1);
+    }
+    std::size_t end = object.find_first_of(",} \t\r\n", pos);
+    return object.substr(pos, end - pos);
+}
+
+// Every {...} in the text is one result
+std::vector<Result> parseResults(const std::string& text) {
+    std::vector<Result> results;
+    std::size_t pos = 0;
+    while ((pos = text.find('{', pos)) != std::string::npos) {
+        std::size_t end = text.find('}', pos);
+        if (end == std::string::npos) {
+            break;
+        }
+        std::string object = text.substr(pos, end - pos + 1);
+        Result result;
+        result.workload = field(object, "workload");
+        result.json = object;
+        result.opsPerSecond = std::atof(field(object, "ops_per_second").c_str());
+        if (!result.workload.empty()) {
+            results.push_back(result);
+        }
+        pos = end + 1;
+    }
+    return results;
+}
+
+int merge(const std::string& baselinePath, const std::vector<std::string>& resultPaths) {
+    std::ofstream out(baselinePath);
+    if (!out) {
+        std::cerr << "Cannot write " << baselinePath << "\n";
+        return 2;
+    }
+    out << "[\n";
+    bool first = true;
+    for (const auto& path : resultPaths) {
+        for (const auto& result : parseResults(readFile(path))) {
+            out << (first ? "  " : ",\n  ") << result.json;
+            first = false;
+        }
+    }
+    out << "\n]\n";
+    std::cout << "Wrote baseline " << baselinePath << "\n";
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    bool mergeMode = false;
+    double threshold = 10.0;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--merge") == 0) {
+            mergeMode = true;
+        } else if (std::strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            threshold = std::atof(argv[++i]);
+        } else {
+            paths.emplace_back(argv[i]);
+        }
+    }
+
+    if (paths.size() < 2) {
+        std::cerr << "Usage: compare_results <baseline.json> <result.json>... [--threshold PERCENT]\n"
+                  << "       compare_results --merge <baseline.json> <result.json>...\n";
+        return 2;
+    }
+
+    std::vector<std::string> resultPaths(paths.begin() + 1, paths.end());
+    if (mergeMode) {
+        return merge(paths[0], resultPaths);
+    }
+
+    std::map<std::string, double> baseline;
+    for (const auto& result : parseResults(readFile(paths[0]))) {
+        baseline[result.workload] = result.opsPerSecond;
+    }
+    std::map<std::string, bool> measured;
+
+    int regressions = 0;
+    std::cout << std::left << std::setw(12) << "workload" << std::right << std::setw(16)
+              << "baseline ops/s" << std::setw(16) << "current ops/s" << std::setw(10) << "change\n";
+
+    for (const auto& path : resultPaths) {
+        for (const auto& result : parseResults(readFile(path))) {
+            measured[result.workload] = true;
+            auto it = baseline.find(result.workload);
+            std::cout << std::left << std::setw(12) << result.workload << std::right;
+            if (it == baseline.end() || it->second <= 0.0) {
+                std::cout << std::setw(16) << "-" << std::setw(16) << std::fixed
+                          << std::setprecision(0) << result.opsPerSecond << "   (no baseline)\n";
+                continue;
+            }
+
+            double change = (result.opsPerSecond - it->second) / it->second * 100.0;
+            bool regressed = change < -threshold;
+            regressions += regressed;
+            std::cout << std::fixed << std::setprecision(0) << std::setw(16) << it->second
+                      << std::setw(16) << result.opsPerSecond << std::setw(8)
+                      << std::setprecision(1) << std::showpos << change << "%"
+                      << std::noshowpos << (regressed ? "  REGRESSION" : "") << "\n";
+        }
+    }
+
+    // A workload that crashed or was dropped produces no result; that must
+    // not pass as "no regression"
+    int missing = 0;
+    for (const auto& entry : baseline) {
+        if (!measured[entry.first]) {
+            ++missing;
+            std::cout << std::left << std::setw(12) << entry.first << std::right << std::fixed
+                      << std::setprecision(0) << std::setw(16) << entry.second << std::setw(16)
+                      << "-" << "   MISSING (no result)\n";
+        }
+    }
+
+    if (regressions > 0 || missing > 0) {
+        if (regressions > 0) {
+            std::cout << regressions << " workload(s) regressed by more than " << threshold << "%\n";
+        }
+        if (missing > 0) {
+            std::cout << missing << " baseline workload(s) have no result\n";
+        }
+        return 1;
+    }
+    std::cout << "No regressions beyond " << threshold << "%\n";
+    return 0;
+}
@@ -1,49 +1,10 @@
 #include <iostream>
-#include <string>
+
+#include "calculator.h"
 
 // Modern C++ example: Basic class with abstraction
-class Calculator {
-private:
-    // Private members - hidden implementation
-    int lastResult = 0;
-    
-    // Private method - internal use only
-    void storeResult(int result) {
-        lastResult = result;
-    }
-    
-public:
-    // Constructor
-    Calculator() = default;
-    
-    // Destructor
-    ~Calculator() = default;
-    
-    // Public interface - only what users need to see
-    int add(int a, int b) const {
-        return a + b;
-    }
-    
-    int subtract(int a, int b) const {
-        return a - b;
-    }
-    
-    int multiply(int a, int b) const {
-        return a * b;
-    }
-    
-    double divide(int a, int b) const {
-        if (b == 0) {
-            std::cerr << "Error: Division by zero\n";
-            return 0.0;
-        }
-        return static_cast<double>(a) / b;
-    }
-    
-    int getLastResult() const {
-        return lastResult;
-    }
-};
+
+using abstraction::Calculator;
 
 int main() {
     Calculator calc;
@@ -0,0 +1,238 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../common/allocation_tracker.h"
+#include "car.h"
+
+// Example: Same abstraction, smaller representation
+//
+// Car (car.h, used by 02_attributes_and_methods.cpp) stores two
+// std::strings and three scalars - 80 bytes per car on a 64-bit build.
+// Users of the class only see its methods, so we are free to store the
+// same information differently. PackedCar keeps brand and model as small
+// IDs into a shared name table and packs year, speed and running state
+// into one 32-bit word: 8 bytes.
+
+using abstraction::Car;
+
+// Every distinct brand/model name is stored once; cars hold 16-bit IDs
+class NameTable {
+private:
+    std::vector<std::string> names;
+    std::unordered_map<std::string, std::uint16_t> ids;
+
+    NameTable() { intern("Unknown"); }
+
+public:
+    static NameTable& instance() {
+        static NameTable table;
+        return table;
+    }
+
+    std::uint16_t intern(const std::string& name) {
+        auto it = ids.find(name);
+        if (it != ids.end()) {
+            return it->second;
+        }
+        // IDs are 16 bits wide; wrapping around would alias two names
+        if (names.size() > std::numeric_limits<std::uint16_t>::max()) {
+            throw std::length_error("NameTable: more than 65536 distinct names");
+        }
+        auto id = static_cast<std::uint16_t>(names.size());
+        names.push_back(name);
+        ids.emplace(name, id);
+        return id;
+    }
+
+    const std::string& lookup(std::uint16_t id) const { return names[id]; }
+};
+
+class PackedCar {
+private:
+    std::uint16_t brandId = 0;
+    std::uint16_t modelId = 0;
+    // Year 0-4095 (12 bits); speed is always a multiple of 10 up to 200,
+    // so it is stored in steps of 10 (5 bits); one bit for the engine.
+    std::uint32_t year : 12;
+    std::uint32_t speedSteps : 5;
+    std::uint32_t isRunning : 1;
+
+    static constexpr int SPEED_STEP = 10;
+    static constexpr int MAX_SPEED = 200;
+    static constexpr int MAX_YEAR = (1 << 12) - 1;
+
+    // The bit-field would silently keep only the low 12 bits
+    static std::uint32_t checkedYear(int year) {
+        if (year < 0 || year > MAX_YEAR) {
+            throw std::out_of_range("PackedCar: year " + std::to_string(year) +
+                                    " does not fit in 12 bits (0-4095)");
+        }
+        return static_cast<std::uint32_t>(year);
+    }
+
+public:
+    PackedCar(const std::string& brand, const std::string& model, int year)
+        : brandId(NameTable::instance().intern(brand)),
+          modelId(NameTable::instance().intern(model)),
+          year(checkedYear(year)), speedSteps(0), isRunning(0) {}
+
+    // Car's public getters are enough to read its whole state
+    explicit PackedCar(const Car& car) : PackedCar(car.getBrand(), car.getModel(), car.getYear()) {
+        speedSteps = static_cast<std::uint32_t>(car.getSpeed() / SPEED_STEP);
+        isRunning = car.isCarRunning();
+    }
+
+    // Car has no setters, so its state is rebuilt by driving it there.
+    // Car only has speed while its engine runs, so this reaches every
+    // state a PackedCar made from a Car can be in.
+    Car toCar() const {
+        Car car(getBrand(), getModel(), getYear());
+        std::cout.setstate(std::ios::failbit);  // the replay is not news
+        if (isRunning) {
+            car.startEngine();
+        }
+        for (std::uint32_t step = 0; step < speedSteps; ++step) {
+            car.accelerate();
+        }
+        std::cout.clear();
+        return car;
+    }
+
+    const std::string& getBrand() const { return NameTable::instance().lookup(brandId); }
+    const std::string& getModel() const { return NameTable::instance().lookup(modelId); }
+    int getYear() const { return static_cast<int>(year); }
+    bool isCarRunning() const { return isRunning; }
+    int getSpeed() const { return static_cast<int>(speedSteps) * SPEED_STEP; }
+
+    void startEngine() {
+        if (!isRunning) {
+            isRunning = 1;
+            std::cout << getBrand() << " " << getModel() << " engine started\n";
+        }
+    }
+
+    void stopEngine() {
+        if (isRunning) {
+            isRunning = 0;
+            speedSteps = 0;
+            std::cout << getBrand() << " " << getModel() << " engine stopped\n";
+        }
+    }
+
+    void accelerate() {
+        if (isRunning && getSpeed() < MAX_SPEED) {
+            ++speedSteps;
+            std::cout << "Speed: " << getSpeed() << " km/h\n";
+        }
+    }
+
+    void decelerate() {
+        if (speedSteps > 0) {
+            --speedSteps;
+            std::cout << "Speed: " << getSpeed() << " km/h\n";
+        }
+    }
+};
+
+static_assert(sizeof(PackedCar) <= 16, "PackedCar must stay within 16 bytes");
+
+// ---------------------------------------------------------------------------
+// Benchmark
+// ---------------------------------------------------------------------------
+
+const char* const BRANDS[] = { "Toyota", "Ford", "Volkswagen", "Hyundai" };
+const char* const MODELS[] = { "Corolla", "Focus", "Golf", "Elantra", "Mercedes-Benz Sprinter" };
+
+// One simulated tick: start, speed up, slow down, sometimes stop
+template <typename CarType>
+double updatesPerSecond(std::vector<CarType>& fleet, int ticks) {
+    // Both classes print every state change; nobody reads millions of those
+    std::cout.setstate(std::ios::failbit);
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; ++tick) {
+        for (std::size_t i = 0; i < fleet.size(); ++i) {
+            CarType& car = fleet[i];
+            car.startEngine();
+            car.accelerate();
+            car.accelerate();
+            car.decelerate();
+            if ((i + tick) % 8 == 0) {
+                car.stopEngine();
+            }
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout.clear();
+    return static_cast<double>(fleet.size()) * ticks / seconds;
+}
+
+template <typename CarType>
+std::vector<CarType> buildFleet(std::size_t count) {
+    std::vector<CarType> fleet;
+    fleet.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        fleet.emplace_back(BRANDS[i % 4], MODELS[i % 5], 1990 + static_cast<int>(i % 35));
+    }
+    return fleet;
+}
+
+// Heap bytes are measured by the allocation tracker while the fleet is
+// built: the vector itself plus every long name's heap buffer
+void printFleet(const char* label, std::size_t objectSize, std::size_t heapBytes, double updates) {
+    std::cout << label << " " << objectSize << " bytes each, " << std::fixed << std::setprecision(1)
+              << static_cast<double>(heapBytes) / (1024 * 1024) << " MiB on the heap, " << static_cast<long long>(updates) << " car updates/s\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "=== Same behaviour, different storage ===\n";
+    Car car("Toyota", "Corolla", 2023);
+    PackedCar packed(car);
+    car.startEngine();
+    packed.startEngine();
+    car.accelerate();
+    packed.accelerate();
+    car.accelerate();
+    packed.accelerate();
+    car.decelerate();
+    packed.decelerate();
+
+    Car roundTrip = packed.toCar();
+    std::cout << "Round trip: " << roundTrip.getBrand() << " " << roundTrip.getModel()
+              << " " << roundTrip.getYear() << ", running " << std::boolalpha
+              << roundTrip.isCarRunning() << ", " << roundTrip.getSpeed() << " km/h\n";
+
+    // Usage: abstraction_04_packed_car [cars]   e.g. 10000000 for 10M cars
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 2'000'000;
+    constexpr int TICKS = 5;
+
+    std::cout << "\n=== " << count << " cars: heap use and update throughput (" << TICKS
+              << " ticks) ===\n";
+    {
+        allocation::Scope scope("Car fleet");
+        auto fleet = buildFleet<Car>(count);
+        printFleet("Car:      ", sizeof(Car), scope.stats().peakBytes, updatesPerSecond(fleet, TICKS));
+    }
+    {
+        allocation::Scope scope("PackedCar fleet");
+        auto fleet = buildFleet<PackedCar>(count);
+        printFleet("PackedCar:", sizeof(PackedCar), scope.stats().peakBytes,
+                   updatesPerSecond(fleet, TICKS));
+    }
+
+    std::cout << "\n=== Out-of-range values are rejected ===\n";
+    try {
+        PackedCar future("Toyota", "Corolla", 5000);
+    } catch (const std::out_of_range& error) {
+        std::cout << error.what() << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "../common/layout_fields.h"
+
+// Car from 02_attributes_and_methods.cpp.
+
+namespace abstraction {
+
+class Car {
+private:
+    // Private attributes with default initialization (modern C++)
+    std::string brand = "Unknown";
+    std::string model = "Unknown";
+    int year = 0;
+    bool isRunning = false;
+    int speed = 0;
+    LAYOUT_FIELDS(Car, brand, model, year, isRunning, speed)
+    
+public:
+    // Constructor using member initializer list
+    Car(std::string brand, std::string model, int year)
+        : brand(std::move(brand)), model(std::move(model)), year(year) {}
+    
+    // Destructor
+    ~Car() = default;
+    
+    // Getters - const methods that don't modify state
+    const std::string& getBrand() const { return brand; }
+    const std::string& getModel() const { return model; }
+    int getYear() const { return year; }
+    bool isCarRunning() const { return isRunning; }
+    int getSpeed() const { return speed; }
+    
+    // Methods that modify state
+    void startEngine() {
+        if (!isRunning) {
+            isRunning = true;
+            std::cout << brand << " " << model << " engine started\n";
+        }
+    }
+    
+    void stopEngine() {
+        if (isRunning) {
+            isRunning = false;
+            speed = 0;
+            std::cout << brand << " " << model << " engine stopped\n";
+        }
+    }
+    
+    void accelerate() {
+        if (isRunning && speed < 200) {
+            speed += 10;
+            std::cout << "Speed: " << speed << " km/h\n";
+        }
+    }
+    
+    void decelerate() {
+        if (speed > 0) {
+            speed -= 10;
+            std::cout << "Speed: " << speed << " km/h\n";
+        }
+    }
+    
+    // Method to display all car info
+    void displayInfo() const {
+        std::cout << "\n=== Car Information ===\n";
+        std::cout << "Brand: " << brand << "\n";
+        std::cout << "Model: " << model << "\n";
+        std::cout << "Year: " << year << "\n";
+        std::cout << "Running: " << (isRunning ? "Yes" : "No") << "\n";
+        std::cout << "Speed: " << speed << " km/h\n";
+    }
+};
+
+}  // namespace abstraction
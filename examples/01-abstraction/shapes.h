@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "../common/layout_fields.h"
+
+// Shape hierarchy from 03_abstract_classes.cpp.
+
+namespace abstraction {
+
+// Abstract base class
+class Shape {
+protected:
+    std::string name;
+    LAYOUT_FIELDS(Shape, name)
+    
+public:
+    Shape(std::string name) : name(std::move(name)) {}
+    
+    // Virtual destructor - CRITICAL for polymorphic classes
+    virtual ~Shape() = default;
+    
+    // Pure virtual functions - must be implemented by derived classes
+    virtual double getArea() const = 0;
+    virtual double getPerimeter() const = 0;
+    
+    // Virtual method with default implementation
+    virtual void display() const {
+        std::cout << "Shape: " << name << std::endl;
+    }
+};
+
+// Concrete implementation: Circle
+class Circle : public Shape {
+private:
+    double radius;
+    LAYOUT_DERIVED_FIELDS(Circle, Shape, radius)
+    static constexpr double PI = 3.14159;
+    
+public:
+    Circle(std::string name, double radius)
+        : Shape(std::move(name)), radius(radius) {}
+    
+    double getArea() const override {
+        return PI * radius * radius;
+    }
+    
+    double getPerimeter() const override {
+        return 2 * PI * radius;
+    }
+};
+
+// Concrete implementation: Rectangle
+class Rectangle : public Shape {
+private:
+    double width, height;
+    LAYOUT_DERIVED_FIELDS(Rectangle, Shape, width, height)
+    
+public:
+    Rectangle(std::string name, double width, double height)
+        : Shape(std::move(name)), width(width), height(height) {}
+    
+    double getArea() const override {
+        return width * height;
+    }
+    
+    double getPerimeter() const override {
+        return 2 * (width + height);
+    }
+};
+
+// Concrete implementation: Triangle
+class Triangle : public Shape {
+private:
+    double a, b, c;  // side lengths
+    LAYOUT_DERIVED_FIELDS(Triangle, Shape, a, b, c)
+    
+public:
+    Triangle(std::string name, double a, double b, double c)
+        : Shape(std::move(name)), a(a), b(b), c(c) {}
+    
+    double getArea() const override {
+        // Heron's formula
+        double s = (a + b + c) / 2.0;
+        return std::sqrt(s * (s - a) * (s - b) * (s - c));
+    }
+    
+    double getPerimeter() const override {
+        return a + b + c;
+    }
+};
+
+}  // namespace abstraction
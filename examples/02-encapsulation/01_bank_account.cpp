@@ -1,114 +1,61 @@
 #include <iostream>
-#include <string>
-#include <vector>
-#include <iomanip>
+
+#include "bank_account.h"
+
+#ifdef TRACK_ALLOCATIONS
+#include "../common/allocation_tracker.h"
+#endif
 
 // Example: Bank account with proper encapsulation
-class BankAccount {
-private:
-    // Private member variables
-    std::string accountNumber;
-    std::string accountHolder;
-    double balance;
-    std::vector<std::string> transactionHistory;
-    
-    // Private helper method
-    void recordTransaction(const std::string& description) {
-        transactionHistory.push_back(description);
-    }
-    
-public:
-    // Constructor
-    BankAccount(const std::string& accountNumber, 
-                const std::string& accountHolder,
-                double initialBalance)
-        : accountNumber(accountNumber),
-          accountHolder(accountHolder),
-          balance(initialBalance) {
-        recordTransaction("Account opened with initial balance: $" + 
-                         std::to_string(initialBalance));
-    }
-    
-    // Destructor
-    ~BankAccount() = default;
-    
-    // Getters - read-only access
-    const std::string& getAccountNumber() const {
-        return accountNumber;
-    }
-    
-    const std::string& getAccountHolder() const {
-        return accountHolder;
-    }
-    
-    double getBalance() const {
-        return balance;
-    }
-    
-    // Public methods with validation
-    bool deposit(double amount) {
-        if (amount <= 0) {
-            std::cout << "Error: Deposit amount must be positive\n";
-            return false;
-        }
-        balance += amount;
-        recordTransaction("Deposited: $" + std::to_string(amount));
-        std::cout << "Deposit successful. New balance: $" 
-                  << std::fixed << std::setprecision(2) << balance << std::endl;
-        return true;
-    }
-    
-    bool withdraw(double amount) {
-        if (amount <= 0) {
-            std::cout << "Error: Withdrawal amount must be positive\n";
-            return false;
-        }
-        if (amount > balance) {
-            std::cout << "Error: Insufficient funds. Available: $" 
-                      << std::fixed << std::setprecision(2) << balance << std::endl;
-            return false;
-        }
-        balance -= amount;
-        recordTransaction("Withdrew: $" + std::to_string(amount));
-        std::cout << "Withdrawal successful. New balance: $" 
-                  << std::fixed << std::setprecision(2) << balance << std::endl;
-        return true;
-    }
-    
-    void displayHistory() const {
-        std::cout << "\n=== Transaction History for " << accountHolder << " ===\n";
-        if (transactionHistory.empty()) {
-            std::cout << "No transactions\n";
-            return;
-        }
-        for (size_t i = 0; i < transactionHistory.size(); ++i) {
-            std::cout << (i + 1) << ". " << transactionHistory[i] << std::endl;
-        }
-    }
-};
+//
+// The balance is a Money (money.h): whole cents in an integer, so amounts
+// like $0.10 are exact and never drift the way a double would.
+
+using encapsulation::BankAccount;
+using encapsulation::Money;
 
 int main() {
-    BankAccount account("ACC-12345", "Alice Smith", 1000.00);
+    BankAccount account("ACC-12345", "Alice Smith", Money::fromDollars(1000.00));
     
     std::cout << "Account Holder: " << account.getAccountHolder() << std::endl;
     std::cout << "Account Number: " << account.getAccountNumber() << std::endl;
-    std::cout << "Initial Balance: $" << std::fixed << std::setprecision(2) 
-              << account.getBalance() << std::endl;
+    std::cout << "Initial Balance: $" << account.getBalance() << std::endl;
     
     std::cout << "\n--- Transactions ---\n";
-    account.deposit(500.00);
-    account.withdraw(200.00);
-    account.withdraw(2000.00);  // Will fail
-    account.deposit(300.00);
+    account.deposit(Money::fromDollars(500.00));
+    account.withdraw(Money::fromDollars(200.00));
+    account.withdraw(Money::fromDollars(2000.00));  // Will fail
+    account.deposit(Money::fromDollars(300.00));
     
     account.displayHistory();
     
-    std::cout << "\nFinal Balance: $" << std::fixed << std::setprecision(2) 
-              << account.getBalance() << std::endl;
+    std::cout << "\nFinal Balance: $" << account.getBalance() << std::endl;
     
     // These would cause compiler errors (private members):
-    // account.balance = -1000;  // ERROR
+    // account.balance = Money::fromCents(-100000);  // ERROR
     // account.transactionHistory.clear();  // ERROR
     
+#ifdef TRACK_ALLOCATIONS
+    // A deposit itself never allocates: only the history vector does, when
+    // it grows. How often that happens depends on the library's growth
+    // policy, so the budget is checked on a history reserved up front,
+    // where the answer is zero everywhere.
+    std::cout << "\n=== Allocation budget ===\n";
+    constexpr int DEPOSITS = 1000;
+    {
+        BankAccount reserved("ACC-67891", "Carol White", Money());
+        reserved.reserveHistory(DEPOSITS + 1);
+        allocation::Scope scope("1000 deposits, reserved");
+        std::cout.setstate(std::ios::failbit);  // skip 1000 confirmation lines
+        for (int i = 0; i < DEPOSITS; ++i) {
+            reserved.deposit(Money::fromCents(100));
+        }
+        std::cout.clear();
+        scope.report();
+        allocation::expectAtMost(scope, 0, "deposit into a reserved history");
+    }
+    return allocation::failures() == 0 ? 0 : 1;
+#else
     return 0;
+#endif
 }
@@ -0,0 +1,167 @@
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../04-polymorphism/animals.h"
+#include "../common/allocation_tracker.h"
+#include "../common/interned_string.h"
+#include "animal.h"
+
+// Example: Interned strings for text members repeated across many objects
+//
+// encapsulation::Animal (animal.h) has three text members that hold the same
+// text in every instance, and polymorphism::Dog/Cat/Bird (animals.h) repeat
+// a handful of breeds, colors and species. As std::string, each is 32 bytes,
+// and text longer than the small-string buffer (15 chars with libstdc++)
+// costs a heap allocation per object. Both headers now intern these members
+// (common/interned_string.h): each distinct text is stored once and objects
+// hold a 4-byte ID instead.
+//
+// "Before" below is those classes' data exactly as it was before interning;
+// "after" is the real classes. Heap bytes are counted by the shared
+// allocation tracker (common/allocation_tracker.h), which this example
+// always links.
+
+// ---------------------------------------------------------------------------
+// Before: the same classes with a std::string per member
+// ---------------------------------------------------------------------------
+
+// encapsulation::Animal before interning
+namespace before::encapsulation {
+
+class Animal {
+private:
+    std::string privateSecret = "I am a private member";
+
+protected:
+    std::string protectedInfo = "I am protected - derived classes can access";
+
+public:
+    std::string publicInfo = "I am public - everyone can access";
+
+    virtual ~Animal() = default;
+};
+
+}  // namespace before::encapsulation
+
+// polymorphism::Dog/Cat/Bird before interning; the base has no data
+namespace before::polymorphism {
+
+class Animal {
+public:
+    virtual ~Animal() = default;
+};
+
+class Dog : public Animal {
+private:
+    std::string breed;
+
+public:
+    Dog(std::string breed) : breed(std::move(breed)) {}
+};
+
+class Cat : public Animal {
+private:
+    std::string color;
+
+public:
+    Cat(std::string color) : color(std::move(color)) {}
+};
+
+class Bird : public Animal {
+private:
+    std::string species;
+
+public:
+    Bird(std::string species) : species(std::move(species)) {}
+};
+
+}  // namespace before::polymorphism
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+
+constexpr std::size_t OBJECT_COUNT = 1'000'000;
+
+const char* const BREEDS[] = { "Golden Retriever", "Husky", "German Shepherd", "Beagle" };
+const char* const COLORS[] = { "Orange", "Black", "Tortoiseshell", "White" };
+const char* const SPECIES[] = { "Parrot", "Canary", "Common Kingfisher", "Robin" };
+
+// Heap bytes still held after building OBJECT_COUNT of each animal type
+template <typename Dog, typename Cat, typename Bird>
+std::size_t heapBytesForAnimals() {
+    std::size_t baseline = allocation::liveBytes();
+
+    std::vector<Dog> dogs;
+    std::vector<Cat> cats;
+    std::vector<Bird> birds;
+    dogs.reserve(OBJECT_COUNT);
+    cats.reserve(OBJECT_COUNT);
+    birds.reserve(OBJECT_COUNT);
+
+    for (std::size_t i = 0; i < OBJECT_COUNT; ++i) {
+        dogs.emplace_back(BREEDS[i % 4]);
+        cats.emplace_back(COLORS[i % 4]);
+        birds.emplace_back(SPECIES[i % 4]);
+    }
+
+    return allocation::liveBytes() - baseline;
+}
+
+// Heap bytes still held after building OBJECT_COUNT default objects
+template <typename T>
+std::size_t heapBytesFor() {
+    std::size_t baseline = allocation::liveBytes();
+    std::vector<T> objects(OBJECT_COUNT);
+    return allocation::liveBytes() - baseline;
+}
+
+void printHeap(const char* label, std::size_t bytes, std::size_t objects) {
+    std::cout << label << bytes / (1024 * 1024) << " MiB (" << bytes / objects << " bytes per object)\n";
+}
+
+int main() {
+    std::cout << "=== Interned members still respect access rules ===\n";
+    encapsulation::Dog access;
+    std::cout << "Public: " << access.publicInfo << "\n";
+    access.demonstrateAccess();
+    polymorphism::Dog("Golden Retriever").describe();
+    polymorphism::Cat("Orange").describe();
+    polymorphism::Bird("Parrot").describe();
+
+    // Same text, same ID - no matter where it came from
+    std::string typed = "Golden Retriever";
+    std::cout << "\nInterned IDs equal: " << std::boolalpha
+              << (InternedString(typed) == InternedString("Golden Retriever")) << "\n";
+
+    std::cout << "\n=== sizeof (before / after) ===\n";
+    std::cout << "std::string / InternedString: " << sizeof(std::string) << " / "
+              << sizeof(InternedString) << " bytes\n";
+    std::cout << "encapsulation::Animal:        " << sizeof(before::encapsulation::Animal) << " / "
+              << sizeof(encapsulation::Animal) << " bytes\n";
+    std::cout << "polymorphism::Dog:            " << sizeof(before::polymorphism::Dog) << " / "
+              << sizeof(polymorphism::Dog) << " bytes\n";
+    std::cout << "polymorphism::Cat:            " << sizeof(before::polymorphism::Cat) << " / "
+              << sizeof(polymorphism::Cat) << " bytes\n";
+    std::cout << "polymorphism::Bird:           " << sizeof(before::polymorphism::Bird) << " / "
+              << sizeof(polymorphism::Bird) << " bytes\n";
+
+    std::cout << "\n=== Heap bytes for 1M encapsulation::Animal ===\n";
+    printHeap("Before: ", heapBytesFor<before::encapsulation::Animal>(), OBJECT_COUNT);
+    printHeap("After:  ", heapBytesFor<encapsulation::Animal>(), OBJECT_COUNT);
+
+    std::cout << "\n=== Heap bytes for 1M dogs + 1M cats + 1M birds ===\n";
+    printHeap("Before: ",
+              heapBytesForAnimals<before::polymorphism::Dog, before::polymorphism::Cat,
+                                  before::polymorphism::Bird>(),
+              3 * OBJECT_COUNT);
+    printHeap("After:  ",
+              heapBytesForAnimals<polymorphism::Dog, polymorphism::Cat, polymorphism::Bird>(),
+              3 * OBJECT_COUNT);
+    std::cout << "Distinct strings in interner: " << StringInterner::instance().size() << "\n";
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "bank_account.h"
+#include "money.h"
+
+#ifdef TRACK_ALLOCATIONS
+#include "../common/allocation_tracker.h"
+#endif
+
+// Example: A fixed-point Money type behind the BankAccount interface
+//
+// BankAccount (bank_account.h, shared with 01_bank_account.cpp) used to keep
+// its balance in a double. Binary floating point cannot represent most cent
+// values exactly (0.10 is really 0.1000000000000000055...), so errors creep
+// in over many transactions. It also built each history line with
+// std::to_string, which allocates.
+//
+// Money (money.h) stores a whole number of cents in a 64-bit integer,
+// refuses to overflow silently, and formats itself into a caller-provided
+// buffer with std::to_chars - no allocation, no locale, no stream state.
+// This example shows why, and measures the formatting.
+
+using encapsulation::BankAccount;
+using encapsulation::Money;
+
+// ---------------------------------------------------------------------------
+// Formatting benchmark
+// ---------------------------------------------------------------------------
+
+template <typename Format>
+double formatsPerSecond(std::size_t count, Format format) {
+    std::size_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        checksum += format(static_cast<std::int64_t>(i * 7919 % 100'000'000));
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    // Printing the checksum keeps the compiler from dropping the loop
+    std::cout << " (checksum " << checksum << ")";
+    return static_cast<double>(count) / seconds;
+}
+
+int main() {
+    BankAccount account("ACC-12345", "Alice Smith", Money::fromCents(100000));
+
+    std::cout << "Account Holder: " << account.getAccountHolder() << "\n";
+    std::cout << "Account Number: " << account.getAccountNumber() << "\n";
+    std::cout << "Initial Balance: $" << account.getBalance() << "\n";
+
+    std::cout << "\n--- Transactions ---\n";
+    account.deposit(Money::fromDollars(500.00));
+    account.withdraw(Money::fromDollars(200.00));
+    account.withdraw(Money::fromDollars(2000.00));  // Will fail
+    account.deposit(Money::fromDollars(300.00));
+    account.displayHistory();
+
+    std::cout << "\n=== Why not double? ===\n";
+    double doubleTotal = 0.0;
+    Money moneyTotal;
+    for (int i = 0; i < 1'000'000; ++i) {
+        doubleTotal += 0.10;
+        moneyTotal += Money::fromCents(10);
+    }
+    std::cout << "1M deposits of $0.10 as double: " << std::setprecision(17) << doubleTotal << "\n";
+    std::cout << "1M deposits of $0.10 as Money:  " << moneyTotal << "\n";
+
+    std::cout << "\n=== Checked arithmetic ===\n";
+    try {
+        Money::fromCents(std::numeric_limits<std::int64_t>::max()) + Money::fromCents(1);
+    } catch (const std::overflow_error& e) {
+        std::cout << "Caught: " << e.what() << "\n";
+    }
+
+    constexpr std::size_t COUNT = 2'000'000;
+    std::cout << "\n=== Formatting " << COUNT << " amounts ===\n";
+
+    std::cout << "std::to_string(double)";
+    double toStringRate = formatsPerSecond(COUNT, [](std::int64_t cents) {
+        return std::to_string(static_cast<double>(cents) / 100.0).size();
+    });
+    std::cout << ": " << static_cast<long long>(toStringRate) << " /s\n";
+
+    std::cout << "ostringstream + setprecision(2)";
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(2);
+    double streamRate = formatsPerSecond(COUNT, [&stream](std::int64_t cents) {
+        stream.str({});
+        stream << static_cast<double>(cents) / 100.0;
+        return stream.str().size();
+    });
+    std::cout << ": " << static_cast<long long>(streamRate) << " /s\n";
+
+    std::cout << "Money::format into buffer";
+    double moneyRate = formatsPerSecond(COUNT, [](std::int64_t cents) {
+        char buffer[Money::MAX_FORMATTED_LENGTH];
+        auto result = Money::fromCents(cents).format(buffer, buffer + sizeof(buffer));
+        return static_cast<std::size_t>(result.ptr - buffer);
+    });
+    std::cout << ": " << static_cast<long long>(moneyRate) << " /s\n";
+
+#ifdef TRACK_ALLOCATIONS
+    // Formatting is on every deposit's path and must not touch the heap.
+    // A change that brings allocations back makes this example - and its
+    // test (ctest -L alloc) - fail. Deposits themselves are budgeted in
+    // 01_bank_account.cpp.
+    std::cout << "\n=== Allocation budget ===\n";
+    {
+        allocation::Scope scope("1000 Money::format");
+        std::size_t length = 0;
+        for (std::int64_t cents = 0; cents < 1000; ++cents) {
+            char buffer[Money::MAX_FORMATTED_LENGTH];
+            auto result = Money::fromCents(cents * 100'000'000).format(buffer, buffer + sizeof(buffer));
+            length += static_cast<std::size_t>(result.ptr - buffer);
+        }
+        scope.report();
+        allocation::expectAtMost(scope, 0, "Money::format");
+        std::cout << "(formatted " << length << " characters)" << std::endl;
+    }
+    {
+        // For comparison only: the original's history lines
+        allocation::Scope scope("1000 std::to_string(double)");
+        std::size_t length = 0;
+        for (std::int64_t cents = 0; cents < 1000; ++cents) {
+            length += std::to_string(static_cast<double>(cents) * 1'000'000.0).size();
+        }
+        scope.report();
+        std::cout << "(formatted " << length << " characters)" << std::endl;
+    }
+    return allocation::failures() == 0 ? 0 : 1;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,619 @@
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bank_account.h"
+#include "money.h"
+
+using encapsulation::BankAccount;
+using encapsulation::Money;
+
+// Example: Making BankAccount durable with a write-ahead log
+//
+// BankAccount (bank_account.h) lives only in memory - a crash loses every
+// deposit and withdrawal. Here each mutation is first appended to a log
+// file, and the operation only reports success once the log entry is on
+// disk. After a crash the account is rebuilt by replaying the log.
+//
+// Forcing data to disk (fdatasync) takes far longer than the mutation
+// itself, so the log uses group commit: a background thread collects the
+// records that arrive within a short window and makes them all durable
+// with a single fdatasync. Callers still wait for their own record, but
+// many callers share the cost of one sync. Each batch ends with a commit
+// record, and replay applies a batch only if its commit record made it to
+// disk, so a batch that was cut short is never half applied.
+//
+// The account only changes its balance once the record is durable. If a
+// write or sync fails, the operation reports failure and the balance is
+// left as it was; the log stops accepting writes from then on. Should the
+// failed batch be complete on disk and impossible to remove, its outcome
+// is unknown: those callers get an exception instead of "failed", and the
+// log refuses every later append until it is reopened and replayed.
+//
+// POSIX only (open/write/fdatasync).
+
+#if defined(__APPLE__)
+// macOS has no fdatasync; fsync gives the same guarantee here
+inline int fdatasync(int fd) { return fsync(fd); }
+#endif
+
+// ---------------------------------------------------------------------------
+// Log record format
+// ---------------------------------------------------------------------------
+
+// A Commit record closes a batch: its sequence is the batch's last one and
+// its amount the number of records in the batch
+enum class Operation : std::uint8_t { Deposit = 1, Withdrawal = 2, Commit = 3 };
+
+// Fixed 24-byte record: sequence(8) amount(8) operation(1) unused(3) checksum(4)
+struct LogRecord {
+    static constexpr std::size_t SIZE = 24;
+
+    std::uint64_t sequence;
+    std::int64_t amountCents;
+    Operation operation;
+
+    static std::uint32_t checksum(const unsigned char* bytes, std::size_t length) {
+        // FNV-1a: enough to detect a torn or half-written record
+        std::uint32_t hash = 2166136261u;
+        for (std::size_t i = 0; i < length; ++i) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    void encode(unsigned char* out) const {
+        std::memset(out, 0, SIZE);
+        std::memcpy(out, &sequence, 8);
+        std::memcpy(out + 8, &amountCents, 8);
+        out[16] = static_cast<unsigned char>(operation);
+        std::uint32_t sum = checksum(out, 20);
+        std::memcpy(out + 20, &sum, 4);
+    }
+
+    // Returns false for a record that is damaged or incomplete
+    static bool decode(const unsigned char* in, LogRecord& record) {
+        std::uint32_t stored;
+        std::memcpy(&stored, in + 20, 4);
+        if (stored != checksum(in, 20)) {
+            return false;
+        }
+        std::memcpy(&record.sequence, in, 8);
+        std::memcpy(&record.amountCents, in + 8, 8);
+        record.operation = static_cast<Operation>(in[16]);
+        return record.operation == Operation::Deposit || record.operation == Operation::Withdrawal ||
+               record.operation == Operation::Commit;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// The write-ahead log
+// ---------------------------------------------------------------------------
+
+class WriteAheadLog {
+private:
+    int fd = -1;
+    std::chrono::microseconds batchWindow;
+
+    std::mutex mutex;
+    std::condition_variable pendingReady;   // flusher waits for work
+    std::condition_variable durable;        // callers wait for their sequence
+    std::vector<unsigned char> pending;     // encoded records not yet written
+    std::uint64_t nextSequence = 1;
+    std::uint64_t settledSequence = 0;      // written and synced, or given up on
+    std::uint64_t syncCount = 0;
+    bool stopping = false;
+
+    // First sequence that did not become durable; every later one fails too
+    static constexpr std::uint64_t NO_FAILURE = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t failedFrom = NO_FAILURE;
+    // Last sequence of a failed batch that may still be in the file; 0 if none
+    std::uint64_t unknownUntil = 0;
+
+    off_t durableBytes = 0;  // only touched by the flusher once it runs
+
+    std::thread flusher;
+
+    void flushLoop() {
+        std::vector<unsigned char> batch;
+        std::unique_lock lock(mutex);
+        while (true) {
+            pendingReady.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (pending.empty() && stopping) {
+                return;
+            }
+
+            // Let more records join this batch, up to the latency budget
+            if (batchWindow.count() > 0 && !stopping) {
+                pendingReady.wait_for(lock, batchWindow, [this] { return stopping; });
+            }
+
+            batch.swap(pending);
+            std::uint64_t batchEnd = nextSequence - 1;
+            bool healthy = failedFrom == NO_FAILURE;
+            lock.unlock();
+
+            LogRecord commit{batchEnd, static_cast<std::int64_t>(batch.size() / LogRecord::SIZE),
+                             Operation::Commit};
+            std::size_t recordBytes = batch.size();
+            batch.resize(recordBytes + LogRecord::SIZE);
+            commit.encode(batch.data() + recordBytes);
+
+            // After a failure nothing more is written: the records that follow
+            // were never applied, so they must not be replayed either
+            bool written = healthy && writeAll(batch.data(), batch.size());
+            bool ok = written && fdatasync(fd) == 0;
+            bool unknown = false;
+            if (ok) {
+                durableBytes += static_cast<off_t>(batch.size());
+            } else if (written) {
+                // The whole batch, commit record included, is in the file but
+                // may or may not be on disk: it has to go, or a replay would
+                // apply operations their callers were told had failed.
+                // (A write that failed part way never wrote the commit record,
+                // so replay already ignores that batch.)
+                unknown = ::ftruncate(fd, durableBytes) != 0 || fdatasync(fd) != 0;
+            }
+            batch.clear();
+
+            lock.lock();
+            syncCount += healthy;
+            if (!ok && failedFrom == NO_FAILURE) {
+                failedFrom = settledSequence + 1;
+                unknownUntil = unknown ? batchEnd : 0;
+            }
+            settledSequence = batchEnd;
+            durable.notify_all();
+        }
+    }
+
+    // A newly created file survives a crash only if its directory entry does.
+    // Cheap enough to do on every open, which also covers a file created by
+    // a run that crashed before getting here.
+    void syncParentDirectory(const std::string& path) {
+        std::string::size_type slash = path.rfind('/');
+        std::string directory = slash == std::string::npos ? "." : path.substr(0, slash == 0 ? 1 : slash);
+        int directoryFd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+        bool ok = directoryFd >= 0 && ::fsync(directoryFd) == 0;
+        if (directoryFd >= 0) {
+            ::close(directoryFd);
+        }
+        if (!ok) {
+            ::close(fd);
+            throw std::runtime_error("Cannot sync directory " + directory);
+        }
+    }
+
+    bool writeAll(const unsigned char* data, std::size_t size) {
+        while (size > 0) {
+            ssize_t written = ::write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+        return true;
+    }
+
+public:
+    // Opens (or creates) the log and hands every committed record to
+    // `replay`. Anything after the last commit record - a damaged tail left
+    // by a crash in the middle of a write, or a batch that failed - is cut off.
+    template <typename Replay>
+    WriteAheadLog(const std::string& path, std::chrono::microseconds batchWindow, Replay replay)
+        : batchWindow(batchWindow) {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open log file " + path);
+        }
+        syncParentDirectory(path);
+
+        off_t goodBytes = 0;  // end of the last committed batch
+        off_t offset = 0;
+        unsigned char buffer[LogRecord::SIZE];
+        LogRecord record{};
+        std::vector<LogRecord> batch;
+        while (::pread(fd, buffer, sizeof(buffer), offset) == static_cast<ssize_t>(sizeof(buffer)) &&
+               LogRecord::decode(buffer, record)) {
+            offset += static_cast<off_t>(sizeof(buffer));
+            if (record.operation != Operation::Commit) {
+                batch.push_back(record);
+                continue;
+            }
+            if (batch.empty() || batch.back().sequence != record.sequence ||
+                static_cast<std::int64_t>(batch.size()) != record.amountCents) {
+                break;  // a commit record that does not match its batch
+            }
+            for (const LogRecord& committed : batch) {
+                replay(committed);
+            }
+            batch.clear();
+            nextSequence = record.sequence + 1;
+            goodBytes = offset;
+        }
+        // Synced, or the cut-off tail could come back after another crash
+        if (::ftruncate(fd, goodBytes) != 0 || ::fsync(fd) != 0 ||
+            ::lseek(fd, goodBytes, SEEK_SET) < 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot truncate damaged log tail");
+        }
+        durableBytes = goodBytes;
+        settledSequence = nextSequence - 1;
+
+        flusher = std::thread([this] { flushLoop(); });
+    }
+
+    ~WriteAheadLog() {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        pendingReady.notify_one();
+        flusher.join();
+        ::close(fd);
+    }
+
+    WriteAheadLog(const WriteAheadLog&) = delete;
+    WriteAheadLog& operator=(const WriteAheadLog&) = delete;
+
+    // Queues a record and returns its sequence number. Throws once a failed
+    // batch could not be removed from the file: only a replay can tell what
+    // the log holds then.
+    std::uint64_t append(Operation operation, std::int64_t amountCents) {
+        std::lock_guard lock(mutex);
+        if (unknownUntil != 0) {
+            throw std::runtime_error("Write-ahead log is in an unknown state - reopen it");
+        }
+        LogRecord record{nextSequence++, amountCents, operation};
+        std::size_t offset = pending.size();
+        pending.resize(offset + LogRecord::SIZE);
+        record.encode(pending.data() + offset);
+        pendingReady.notify_one();
+        return record.sequence;
+    }
+
+    // Blocks until the record with this sequence number is settled; true if
+    // it is on disk, false if it was lost to a write or sync failure. Throws
+    // if the record is in a failed batch that may still be replayed.
+    bool waitDurable(std::uint64_t sequence) {
+        std::unique_lock lock(mutex);
+        durable.wait(lock, [&] { return settledSequence >= sequence; });
+        if (sequence >= failedFrom && sequence <= unknownUntil) {
+            throw std::runtime_error("Write-ahead log: outcome unknown until the log is reopened");
+        }
+        return sequence < failedFrom;
+    }
+
+    std::uint64_t getSyncCount() {
+        std::lock_guard lock(mutex);
+        return syncCount;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// A BankAccount whose mutations survive a crash
+// ---------------------------------------------------------------------------
+
+// Wraps the real BankAccount: it keeps the balance and the history and
+// does the checked Money arithmetic; the log decides when it may change
+class DurableBankAccount {
+private:
+    BankAccount account;       // durable operations only
+    Money incoming;            // deposits waiting for their log record
+    Money reserved;            // withdrawals waiting for their log record
+    std::mutex balanceMutex;
+    WriteAheadLog log;  // declared last: replay in its constructor needs the account
+
+    // BankAccount confirms every change on std::cout; this class answers
+    // through return values instead. Only called with balanceMutex held,
+    // or from the constructor.
+    void apply(Operation operation, Money amount) {
+        auto state = std::cout.rdstate();
+        std::cout.setstate(std::ios::failbit);
+        bool applied = operation == Operation::Deposit ? account.deposit(amount)
+                                                       : account.withdraw(amount);
+        std::cout.clear(state);
+        if (!applied) {
+            throw std::logic_error("Logged operation rejected by the account");
+        }
+    }
+
+public:
+    DurableBankAccount(std::string accountNumber, std::string accountHolder,
+                       const std::string& logPath, std::chrono::microseconds batchWindow)
+        : account(std::move(accountNumber), std::move(accountHolder), Money()),
+          log(logPath, batchWindow, [this](const LogRecord& record) {
+              apply(record.operation, Money::fromCents(record.amountCents));
+          }) {}
+
+    Money getBalance() {
+        std::lock_guard lock(balanceMutex);
+        return account.getBalance();
+    }
+
+    // Returns once the deposit is durable; only then does the balance change
+    bool deposit(Money amount) {
+        if (amount <= Money()) {
+            return false;
+        }
+        std::uint64_t sequence;
+        {
+            // Checked before the record exists: a deposit the balance cannot
+            // take must not reach the log, or every replay would fail on it
+            std::lock_guard lock(balanceMutex);
+            Money pending = incoming + amount;
+            (void)(account.getBalance() + pending);  // Money throws on overflow
+            sequence = log.append(Operation::Deposit, amount.getCents());
+            incoming = pending;
+        }
+        bool durable = log.waitDurable(sequence);
+        std::lock_guard lock(balanceMutex);
+        incoming -= amount;
+        if (durable) {
+            apply(Operation::Deposit, amount);
+        }
+        return durable;
+    }
+
+    // The amount is reserved while the record is in flight, so concurrent
+    // withdrawals cannot overdraw the account, and released if it fails
+    bool withdraw(Money amount) {
+        if (amount <= Money()) {
+            return false;
+        }
+        std::uint64_t sequence;
+        {
+            // Check and append under one lock: a withdrawal enters the log
+            // only after every deposit it relies on is already durable
+            std::lock_guard lock(balanceMutex);
+            if (amount > account.getBalance() - reserved) {
+                return false;
+            }
+            sequence = log.append(Operation::Withdrawal, amount.getCents());
+            reserved += amount;
+        }
+        bool durable = log.waitDurable(sequence);
+        std::lock_guard lock(balanceMutex);
+        reserved -= amount;
+        if (durable) {
+            apply(Operation::Withdrawal, amount);
+        }
+        return durable;
+    }
+
+    std::uint64_t getSyncCount() { return log.getSyncCount(); }
+};
+
+// ---------------------------------------------------------------------------
+// Demo, fault injection and benchmark
+// ---------------------------------------------------------------------------
+
+std::string tempLogPath(const char* name) {
+    const char* dir = std::getenv("TMPDIR");
+    return std::string(dir != nullptr ? dir : "/tmp") + "/" + name + "-" +
+           std::to_string(::getpid()) + ".wal";
+}
+
+// Writes 10 deposits, cuts the file in the middle of the last record
+// (as a crash during write() would), and checks recovery keeps the first 9
+bool truncatedLogRecovers() {
+    std::string path = tempLogPath("wal-fault");
+    std::remove(path.c_str());
+    {
+        DurableBankAccount account("ACC-1", "Alice Smith", path, std::chrono::microseconds(0));
+        for (int i = 1; i <= 10; ++i) {
+            account.deposit(Money::fromCents(i * 100));
+        }
+    }
+
+    struct stat info{};
+    ::stat(path.c_str(), &info);
+    off_t cut = info.st_size - static_cast<off_t>(LogRecord::SIZE / 2);
+    if (::truncate(path.c_str(), cut) != 0) {
+        return false;
+    }
+
+    Money expected;
+    for (int i = 1; i <= 9; ++i) {
+        expected += Money::fromCents(i * 100);
+    }
+
+    bool ok;
+    {
+        DurableBankAccount recovered("ACC-1", "Alice Smith", path, std::chrono::microseconds(0));
+        ok = recovered.getBalance() == expected;
+        std::cout << "Recovered balance after torn write: $" << recovered.getBalance()
+                  << " (expected $" << expected << ")\n";
+
+        // The damaged tail is gone, so new records append cleanly
+        recovered.deposit(Money::fromCents(1));
+    }
+    {
+        DurableBankAccount reopened("ACC-1", "Alice Smith", path, std::chrono::microseconds(0));
+        ok = ok && reopened.getBalance() == expected + Money::fromCents(1);
+    }
+    std::remove(path.c_str());
+    return ok;
+}
+
+// Appends two complete, valid deposit records with no commit record after
+// them - what a failed batch leaves behind when it cannot be cut off - and
+// checks that replay ignores them
+bool uncommittedBatchIsIgnored() {
+    std::string path = tempLogPath("wal-uncommitted");
+    std::remove(path.c_str());
+    {
+        DurableBankAccount account("ACC-3", "Carol White", path, std::chrono::microseconds(0));
+        account.deposit(Money::fromCents(500));
+    }
+
+    unsigned char orphans[2 * LogRecord::SIZE];
+    LogRecord{1000, 100, Operation::Deposit}.encode(orphans);
+    LogRecord{1001, 100, Operation::Deposit}.encode(orphans + LogRecord::SIZE);
+    std::FILE* file = std::fopen(path.c_str(), "ab");
+    bool appended = file != nullptr && std::fwrite(orphans, 1, sizeof(orphans), file) == sizeof(orphans);
+    if (file != nullptr) {
+        std::fclose(file);
+    }
+
+    Money replayed;
+    {
+        DurableBankAccount reopened("ACC-3", "Carol White", path, std::chrono::microseconds(0));
+        replayed = reopened.getBalance();
+    }
+    std::remove(path.c_str());
+
+    std::cout << "Balance with an uncommitted batch in the log: $" << replayed
+              << " (expected $5.00)\n";
+    return appended && replayed == Money::fromCents(500);
+}
+
+// Lets the log hit a file size limit (RLIMIT_FSIZE) after 5 deposits, so
+// the 6th batch fails part way: its deposit record fits, its commit record
+// does not. Checks that the failed operations leave the balance - in
+// memory and after replay - exactly as it was.
+bool failedWriteChangesNothing() {
+    std::string path = tempLogPath("wal-failure");
+    std::remove(path.c_str());
+
+    rlimit original{};
+    ::getrlimit(RLIMIT_FSIZE, &original);
+    rlimit small = original;
+    small.rlim_cur = (5 * 2 + 1) * LogRecord::SIZE;  // 5 batches of record + commit, 1 record
+    auto previousHandler = std::signal(SIGXFSZ, SIG_IGN);  // get EFBIG, not a signal
+    if (::setrlimit(RLIMIT_FSIZE, &small) != 0) {
+        std::signal(SIGXFSZ, previousHandler);
+        return false;
+    }
+
+    Money balance;
+    bool rejected;
+    {
+        DurableBankAccount account("ACC-2", "Bob Jones", path, std::chrono::microseconds(0));
+        for (int i = 0; i < 5; ++i) {
+            account.deposit(Money::fromCents(100));
+        }
+        rejected = !account.deposit(Money::fromCents(100)) &&
+                   !account.deposit(Money::fromCents(100)) &&
+                   !account.withdraw(Money::fromCents(100));
+        balance = account.getBalance();
+    }
+    ::setrlimit(RLIMIT_FSIZE, &original);
+    std::signal(SIGXFSZ, previousHandler);
+
+    Money replayed;
+    {
+        DurableBankAccount reopened("ACC-2", "Bob Jones", path, std::chrono::microseconds(0));
+        replayed = reopened.getBalance();
+    }
+    std::remove(path.c_str());
+
+    std::cout << "Balance after failed writes: $" << balance << ", after replay: $"
+              << replayed << " (expected $5.00)\n";
+    return rejected && balance == Money::fromCents(500) && replayed == Money::fromCents(500);
+}
+
+double committedPerSecond(std::chrono::microseconds window, int threads, int perThread,
+                          std::uint64_t& syncs) {
+    std::string path = tempLogPath("wal-bench");
+    std::remove(path.c_str());
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        DurableBankAccount account("ACC-BENCH", "Benchmark", path, window);
+        std::vector<std::thread> clients;
+        for (int t = 0; t < threads; ++t) {
+            clients.emplace_back([&account, perThread] {
+                for (int i = 0; i < perThread; ++i) {
+                    account.deposit(Money::fromCents(100));
+                }
+            });
+        }
+        for (auto& client : clients) {
+            client.join();
+        }
+        syncs = account.getSyncCount();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::remove(path.c_str());
+    return threads * perThread / seconds;
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: encapsulation_05_wal [--self-test]
+    // --self-test runs only the fault injection check (used by ctest)
+    if (argc > 1 && std::string(argv[1]) == "--self-test") {
+        bool recovered = truncatedLogRecovers();
+        std::cout << (recovered ? "PASS" : "FAIL") << ": recovery kept every complete record\n";
+        bool ignored = uncommittedBatchIsIgnored();
+        std::cout << (ignored ? "PASS" : "FAIL") << ": replay skipped the uncommitted batch\n";
+        bool unchanged = failedWriteChangesNothing();
+        std::cout << (unchanged ? "PASS" : "FAIL") << ": failed writes left the balance alone\n";
+        return recovered && ignored && unchanged ? 0 : 1;
+    }
+
+    std::cout << "=== Crash recovery ===\n";
+    std::string path = tempLogPath("wal-demo");
+    std::remove(path.c_str());
+    {
+        DurableBankAccount account("ACC-12345", "Alice Smith", path, std::chrono::microseconds(200));
+        account.deposit(Money::fromCents(100000));
+        account.deposit(Money::fromCents(50000));
+        account.withdraw(Money::fromCents(20000));
+        std::cout << "Balance before \"crash\": $" << account.getBalance() << "\n";
+    }  // the process could die here - everything acknowledged is in the log
+    {
+        DurableBankAccount account("ACC-12345", "Alice Smith", path, std::chrono::microseconds(200));
+        std::cout << "Balance after replay:   $" << account.getBalance() << "\n";
+    }
+    std::remove(path.c_str());
+
+    std::cout << "\n=== Fault injection: log truncated mid-record ===\n";
+    bool recovered = truncatedLogRecovers();
+    std::cout << (recovered ? "PASS" : "FAIL") << ": recovery kept every complete record\n";
+
+    std::cout << "\n=== Fault injection: uncommitted batch left in the log ===\n";
+    bool ignored = uncommittedBatchIsIgnored();
+    std::cout << (ignored ? "PASS" : "FAIL") << ": replay skipped the uncommitted batch\n";
+
+    std::cout << "\n=== Fault injection: writes fail (file size limit) ===\n";
+    bool unchanged = failedWriteChangesNothing();
+    std::cout << (unchanged ? "PASS" : "FAIL") << ": failed writes left the balance alone\n";
+
+    constexpr int THREADS = 16;
+    constexpr int PER_THREAD = 200;
+    std::cout << "\n=== Committed transactions/s vs. batch window ("
+              << THREADS << " clients) ===\n";
+    for (int windowMicros : {0, 100, 500, 2000}) {
+        std::uint64_t syncs = 0;
+        double rate = committedPerSecond(std::chrono::microseconds(windowMicros),
+                                         THREADS, PER_THREAD, syncs);
+        std::cout << "window " << windowMicros << " us: " << static_cast<long long>(rate)
+                  << " tx/s, " << syncs << " fdatasync calls for "
+                  << THREADS * PER_THREAD << " transactions\n";
+    }
+
+    return recovered && ignored && unchanged ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <iostream>
+
+#include "../common/interned_string.h"
+#include "../common/layout_fields.h"
+
+// Animal and Dog from 02_access_modifiers.cpp.
+
+namespace encapsulation {
+
+// The texts are the same in every Animal, so each member is a 4-byte
+// interned ID (common/interned_string.h) rather than its own std::string
+class Animal {
+private:
+    // Interned once for the whole program; each object copies a plain integer
+    inline static const InternedString DEFAULT_SECRET{"I am a private member"};
+    inline static const InternedString DEFAULT_PROTECTED{"I am protected - derived classes can access"};
+    inline static const InternedString DEFAULT_PUBLIC{"I am public - everyone can access"};
+
+    InternedString privateSecret = DEFAULT_SECRET;
+    
+protected:
+    InternedString protectedInfo = DEFAULT_PROTECTED;
+    
+public:
+    InternedString publicInfo = DEFAULT_PUBLIC;
+    LAYOUT_FIELDS(Animal, privateSecret, protectedInfo, publicInfo)
+    
+    // Public method
+    void publicMethod() const {
+        std::cout << "Public method called\n";
+    }
+    
+    // Destructor
+    virtual ~Animal() = default;
+};
+
+// Derived class
+class Dog : public Animal {
+public:
+    void demonstrateAccess() const {
+        std::cout << "\n=== Inside Dog class ===\n";
+        
+        // Can access public members
+        std::cout << "Public: " << publicInfo << std::endl;
+        
+        // Can access protected members
+        std::cout << "Protected: " << protectedInfo << std::endl;
+        
+        // Cannot access private members (compiler error if uncommented)
+        // std::cout << privateSecret << std::endl;  // ERROR
+    }
+    
+    // Call protected method
+    void useProtectedMethod() {
+        publicMethod();  // Inherited public method
+    }
+};
+
+}  // namespace encapsulation
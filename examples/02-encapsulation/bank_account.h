@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../common/layout_fields.h"
+#include "money.h"
+
+// BankAccount from 01_bank_account.cpp, also used by 04_money_bank_account.cpp.
+
+namespace encapsulation {
+
+class BankAccount {
+public:
+    enum class TransactionType { Opened, Deposit, Withdrawal };
+
+    struct Transaction {
+        TransactionType type;
+        Money amount;
+        LAYOUT_FIELDS(Transaction, type, amount)
+    };
+
+private:
+    // Private member variables
+    std::string accountNumber;
+    std::string accountHolder;
+    Money balance;
+    // Typed records instead of preformatted strings: text is only built
+    // when someone actually looks at the history
+    std::vector<Transaction> transactionHistory;
+    LAYOUT_FIELDS(BankAccount, accountNumber, accountHolder, balance, transactionHistory)
+
+    // Private helper method
+    void recordTransaction(TransactionType type, Money amount) {
+        transactionHistory.push_back({type, amount});
+    }
+
+public:
+    // Constructor
+    BankAccount(std::string accountNumber,
+                std::string accountHolder,
+                Money initialBalance)
+        : accountNumber(std::move(accountNumber)),
+          accountHolder(std::move(accountHolder)),
+          balance(initialBalance) {
+        recordTransaction(TransactionType::Opened, initialBalance);
+    }
+
+    // Destructor
+    ~BankAccount() = default;
+
+    // Getters - read-only access
+    const std::string& getAccountNumber() const {
+        return accountNumber;
+    }
+
+    const std::string& getAccountHolder() const {
+        return accountHolder;
+    }
+
+    Money getBalance() const {
+        return balance;
+    }
+
+    // Callers that know the volume up front can keep the history from
+    // reallocating while transactions come in
+    void reserveHistory(std::size_t transactions) {
+        transactionHistory.reserve(transactions);
+    }
+
+    // Public methods with validation
+    bool deposit(Money amount) {
+        if (amount <= Money()) {
+            std::cout << "Error: Deposit amount must be positive\n";
+            return false;
+        }
+        balance += amount;
+        recordTransaction(TransactionType::Deposit, amount);
+        std::cout << "Deposit successful. New balance: $" << balance << "\n";
+        return true;
+    }
+
+    bool withdraw(Money amount) {
+        if (amount <= Money()) {
+            std::cout << "Error: Withdrawal amount must be positive\n";
+            return false;
+        }
+        if (amount > balance) {
+            std::cout << "Error: Insufficient funds. Available: $" << balance << "\n";
+            return false;
+        }
+        balance -= amount;
+        recordTransaction(TransactionType::Withdrawal, amount);
+        std::cout << "Withdrawal successful. New balance: $" << balance << "\n";
+        return true;
+    }
+
+    void displayHistory() const {
+        std::cout << "\n=== Transaction History for " << accountHolder << " ===\n";
+        if (transactionHistory.empty()) {
+            std::cout << "No transactions\n";
+            return;
+        }
+        for (std::size_t i = 0; i < transactionHistory.size(); ++i) {
+            const Transaction& t = transactionHistory[i];
+            std::cout << (i + 1) << ". ";
+            switch (t.type) {
+                case TransactionType::Opened:
+                    std::cout << "Account opened with initial balance: $";
+                    break;
+                case TransactionType::Deposit:
+                    std::cout << "Deposited: $";
+                    break;
+                case TransactionType::Withdrawal:
+                    std::cout << "Withdrew: $";
+                    break;
+            }
+            std::cout << t.amount << "\n";
+        }
+    }
+};
+
+}  // namespace encapsulation
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <system_error>
+
+#include "../common/layout_fields.h"
+
+// Money: a whole number of cents in a 64-bit integer (see
+// 04_money_bank_account.cpp for why not double). Used by BankAccount in
+// bank_account.h.
+
+namespace encapsulation {
+
+class Money {
+private:
+    std::int64_t cents = 0;
+    LAYOUT_FIELDS(Money, cents)
+
+    explicit constexpr Money(std::int64_t cents) : cents(cents) {}
+
+public:
+    // Longest output: "-92233720368547758.08"
+    static constexpr std::size_t MAX_FORMATTED_LENGTH = 21;
+
+    constexpr Money() = default;
+
+    static constexpr Money fromCents(std::int64_t cents) { return Money(cents); }
+
+    // Rounds to the nearest cent - use only at the boundary with double input
+    static Money fromDollars(double dollars) {
+        double rounded = std::round(dollars * 100.0);
+        if (!(std::abs(rounded) < 9.2e18)) {
+            throw std::overflow_error("Money::fromDollars: amount out of range");
+        }
+        return Money(static_cast<std::int64_t>(rounded));
+    }
+
+    constexpr std::int64_t getCents() const { return cents; }
+
+    // Checked arithmetic - throws instead of wrapping around
+    Money operator+(Money other) const {
+        if ((other.cents > 0 && cents > std::numeric_limits<std::int64_t>::max() - other.cents) ||
+            (other.cents < 0 && cents < std::numeric_limits<std::int64_t>::min() - other.cents)) {
+            throw std::overflow_error("Money: addition overflow");
+        }
+        return Money(cents + other.cents);
+    }
+
+    Money operator-(Money other) const {
+        if ((other.cents < 0 && cents > std::numeric_limits<std::int64_t>::max() + other.cents) ||
+            (other.cents > 0 && cents < std::numeric_limits<std::int64_t>::min() + other.cents)) {
+            throw std::overflow_error("Money: subtraction overflow");
+        }
+        return Money(cents - other.cents);
+    }
+
+    Money& operator+=(Money other) { return *this = *this + other; }
+    Money& operator-=(Money other) { return *this = *this - other; }
+
+    constexpr bool operator==(Money other) const { return cents == other.cents; }
+    constexpr bool operator!=(Money other) const { return cents != other.cents; }
+    constexpr bool operator<(Money other) const { return cents < other.cents; }
+    constexpr bool operator>(Money other) const { return cents > other.cents; }
+    constexpr bool operator<=(Money other) const { return cents <= other.cents; }
+    constexpr bool operator>=(Money other) const { return cents >= other.cents; }
+
+    // Writes "1234.56" into [first, last). Same contract as std::to_chars:
+    // returns the end of the output, or errc::value_too_large if it did not fit.
+    std::to_chars_result format(char* first, char* last) const {
+        // Work with the magnitude as unsigned so INT64_MIN does not overflow
+        std::uint64_t magnitude = cents < 0 ? 0 - static_cast<std::uint64_t>(cents)
+                                            : static_cast<std::uint64_t>(cents);
+        if (cents < 0) {
+            if (first == last) {
+                return {last, std::errc::value_too_large};
+            }
+            *first++ = '-';
+        }
+
+        auto result = std::to_chars(first, last, magnitude / 100);
+        if (result.ec != std::errc() || last - result.ptr < 3) {
+            return {last, std::errc::value_too_large};
+        }
+        auto fraction = static_cast<unsigned>(magnitude % 100);
+        result.ptr[0] = '.';
+        result.ptr[1] = static_cast<char>('0' + fraction / 10);
+        result.ptr[2] = static_cast<char>('0' + fraction % 10);
+        return {result.ptr + 3, std::errc()};
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& out, Money money) {
+    char buffer[Money::MAX_FORMATTED_LENGTH];
+    auto result = money.format(buffer, buffer + sizeof(buffer));
+    return out.write(buffer, result.ptr - buffer);
+}
+
+}  // namespace encapsulation
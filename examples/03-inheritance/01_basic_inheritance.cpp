@@ -1,88 +1,10 @@
 #include <iostream>
-#include <string>
 
-// Base class: Vehicle
-class Vehicle {
-protected:
-    // Protected: accessible to derived classes
-    std::string brand;
-    int year;
-    
-public:
-    // Constructor with member initializer list
-    Vehicle(const std::string& brand, int year)
-        : brand(brand), year(year) {}
-    
-    // Virtual destructor - REQUIRED for polymorphic classes
-    virtual ~Vehicle() = default;
-    
-    // Virtual methods that can be overridden
-    virtual void start() {
-        std::cout << brand << " vehicle starting...\n";
-    }
-    
-    virtual void stop() {
-        std::cout << brand << " vehicle stopping...\n";
-    }
-    
-    // Non-virtual method - same implementation everywhere
-    void printInfo() const {
-        std::cout << "Brand: " << brand << ", Year: " << year << std::endl;
-    }
-};
-
-// Derived class: Car
-class Car : public Vehicle {
-private:
-    int numberOfDoors;
-    
-public:
-    // Constructor calling base class constructor
-    Car(const std::string& brand, int year, int doors)
-        : Vehicle(brand, year), numberOfDoors(doors) {}
-    
-    ~Car() override = default;
-    
-    // Override virtual methods
-    void start() override {
-        std::cout << brand << " car with " << numberOfDoors 
-                  << " doors starting...\n";
-    }
-    
-    void stop() override {
-        std::cout << brand << " car is parking...\n";
-    }
-    
-    // Car-specific method
-    void openTrunk() const {
-        std::cout << "Trunk opened\n";
-    }
-};
+#include "vehicles.h"
 
-// Derived class: Motorcycle
-class Motorcycle : public Vehicle {
-private:
-    bool hasSidecar;
-    
-public:
-    Motorcycle(const std::string& brand, int year, bool hasSidecar)
-        : Vehicle(brand, year), hasSidecar(hasSidecar) {}
-    
-    ~Motorcycle() override = default;
-    
-    void start() override {
-        std::cout << brand << " motorcycle engine roaring...\n";
-    }
-    
-    void stop() override {
-        std::cout << brand << " motorcycle stopped\n";
-    }
-    
-    // Motorcycle-specific method
-    void wheelie() const {
-        std::cout << "Performing a wheelie!\n";
-    }
-};
+using inheritance::Vehicle;
+using inheritance::Car;
+using inheritance::Motorcycle;
 
 int main() {
     // Create derived class objects
@@ -1,55 +1,12 @@
 #include <iostream>
 
-// Example: Virtual functions and override keyword
-class BaseClass {
-public:
-    virtual ~BaseClass() = default;
-    
-    virtual void method1() {
-        std::cout << "BaseClass::method1\n";
-    }
-    
-    virtual void method2() = 0;  // Pure virtual
-    
-    void nonVirtualMethod() {
-        std::cout << "BaseClass::nonVirtualMethod (not virtual)\n";
-    }
-};
+#include "virtual_functions.h"
 
-class DerivedClass : public BaseClass {
-public:
-    ~DerivedClass() override = default;
-    
-    // Override virtual method
-    void method1() override {
-        std::cout << "DerivedClass::method1 (overridden)\n";
-    }
-    
-    // Implement pure virtual
-    void method2() override {
-        std::cout << "DerivedClass::method2 (implemented)\n";
-    }
-    
-    // This does NOT override nonVirtualMethod - it hides it
-    // (not recommended - use override for safety)
-    void nonVirtualMethod() {
-        std::cout << "DerivedClass::nonVirtualMethod (shadows, not overrides)\n";
-    }
-};
+// Example: Virtual functions and override keyword
 
-class FurtherDerived : public DerivedClass {
-public:
-    void method1() override {
-        std::cout << "FurtherDerived::method1\n";
-    }
-    
-    void method2() override {
-        std::cout << "FurtherDerived::method2\n";
-    }
-    
-    // Cannot override - would cause compiler error
-    // virtual void nonVirtualMethod() override { }  // ERROR
-};
+using inheritance::BaseClass;
+using inheritance::DerivedClass;
+using inheritance::FurtherDerived;
 
 int main() {
     BaseClass* base = new DerivedClass();
@@ -0,0 +1,248 @@
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "vehicles.h"
+
+// Example: Vehicles as coroutines on a single-threaded event loop (C++20)
+//
+// The vehicles of 01_basic_inheritance.cpp (vehicles.h) start and stop
+// instantly. Real vehicles wait: an engine warms up, parking takes a while.
+// Giving each vehicle its own thread to sleep in does not scale to 100,000
+// vehicles.
+//
+// A coroutine is a function that can pause at `co_await` and be resumed
+// later. Its local variables live in a small heap "frame" instead of a
+// thread stack, so one thread can juggle a huge number of them. The event
+// loop keeps paused vehicles in a timer wheel and resumes each one when
+// its wait is over. Time is simulated, so the demo runs instantly.
+
+// ---------------------------------------------------------------------------
+// Task: the coroutine type returned by vehicle routines
+// ---------------------------------------------------------------------------
+
+namespace frames {
+    std::size_t live = 0;
+    std::size_t bytes = 0;
+    std::size_t lastFrameSize = 0;
+}
+
+class Task {
+public:
+    struct promise_type {
+        // Frames are counted so we can report memory per coroutine
+        static void* operator new(std::size_t size) {
+            ++frames::live;
+            frames::bytes += size;
+            frames::lastFrameSize = size;
+            return ::operator new(size);
+        }
+        static void operator delete(void* frame, std::size_t size) {
+            --frames::live;
+            frames::bytes -= size;
+            ::operator delete(frame);
+        }
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        // Created paused; the event loop decides when it first runs
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        // Stay alive after finishing so the owner can destroy the frame
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::abort(); }
+    };
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&&) = delete;
+
+    ~Task() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    std::coroutine_handle<> getHandle() const { return handle; }
+    bool done() const { return handle.done(); }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+};
+
+// ---------------------------------------------------------------------------
+// Event loop with a hashed timer wheel
+// ---------------------------------------------------------------------------
+
+// The wheel has one bucket per millisecond. A wait of d ms goes into bucket
+// (now + d) % WHEEL_SIZE and records how many full turns it still has to
+// wait. Scheduling and firing are O(1) no matter how many timers exist.
+class EventLoop {
+private:
+    static constexpr std::size_t WHEEL_SIZE = 4096;
+
+    struct Timer {
+        std::coroutine_handle<> handle;
+        std::uint32_t rounds;  // full wheel turns left before it fires
+    };
+
+    std::vector<std::vector<Timer>> wheel{WHEEL_SIZE};
+    std::vector<Timer> firing;  // reused buffer for the bucket being processed
+    std::uint64_t now = 0;      // simulated milliseconds
+    std::size_t pending = 0;
+    std::uint64_t events = 0;
+
+public:
+    std::uint64_t getTime() const { return now; }
+    std::uint64_t getEventCount() const { return events; }
+
+    void schedule(std::coroutine_handle<> handle, std::uint64_t delayMs) {
+        std::uint64_t due = now + (delayMs == 0 ? 1 : delayMs);
+        auto rounds = static_cast<std::uint32_t>((due - now - 1) / WHEEL_SIZE);
+        wheel[due % WHEEL_SIZE].push_back({handle, rounds});
+        ++pending;
+    }
+
+    // `co_await loop.sleep(ms)` pauses the calling coroutine for ms of simulated time
+    auto sleep(std::uint64_t delayMs) {
+        struct Awaiter {
+            EventLoop& loop;
+            std::uint64_t delayMs;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { loop.schedule(handle, delayMs); }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this, delayMs};
+    }
+
+    void run() {
+        while (pending > 0) {
+            ++now;
+            auto& bucket = wheel[now % WHEEL_SIZE];
+            if (bucket.empty()) {
+                continue;
+            }
+            // Resuming may schedule into this same bucket, so work on a copy
+            firing.swap(bucket);
+            for (Timer& timer : firing) {
+                if (timer.rounds > 0) {
+                    --timer.rounds;
+                    bucket.push_back(timer);
+                    continue;
+                }
+                --pending;
+                ++events;
+                timer.handle.resume();
+            }
+            firing.clear();
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Driving the vehicles from vehicles.h
+// ---------------------------------------------------------------------------
+
+// How long starting and stopping take. The classes in vehicles.h only
+// know what happens, not how long it takes, so each task is told.
+struct DriveTimes {
+    std::uint64_t warmUpMs;
+    std::uint64_t parkingMs;
+};
+
+constexpr DriveTimes CAR_TIMES{1500, 8000};
+constexpr DriveTimes MOTORCYCLE_TIMES{300, 1000};
+constexpr DriveTimes SIDECAR_TIMES{300, 3000};
+
+// The whole life of a vehicle as one coroutine. start() and stop() are the
+// vehicles' own virtual functions; the waits around them are the coroutine's.
+// The vehicle must outlive the task.
+Task drive(EventLoop& loop, inheritance::Vehicle& vehicle, DriveTimes times, int trips,
+           std::uint64_t tripMs) {
+    for (int trip = 0; trip < trips; ++trip) {
+        co_await loop.sleep(times.warmUpMs);
+        std::cout << "[" << loop.getTime() << " ms] ";
+        vehicle.start();
+        co_await loop.sleep(tripMs);
+        std::cout << "[" << loop.getTime() << " ms] ";
+        vehicle.stop();
+        co_await loop.sleep(times.parkingMs);
+    }
+}
+
+// Starts every task on the loop and runs until all have finished
+void runAll(EventLoop& loop, std::vector<Task>& tasks) {
+    for (const Task& task : tasks) {
+        loop.schedule(task.getHandle(), 0);
+    }
+    loop.run();
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "=== Two vehicles sharing one thread ===\n";
+    {
+        EventLoop loop;
+        inheritance::Car car("Toyota", 2023, 4);
+        inheritance::Motorcycle bike("Harley-Davidson", 2022, false);
+        std::vector<Task> tasks;
+        tasks.push_back(drive(loop, car, CAR_TIMES, 2, 5000));
+        tasks.push_back(drive(loop, bike, MOTORCYCLE_TIMES, 2, 2000));
+        runAll(loop, tasks);
+    }
+
+    // Usage: inheritance_04_coroutines [vehicles]
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100'000;
+    constexpr int TRIPS = 10;
+
+    std::cout << "\n=== " << count << " concurrent vehicles, " << TRIPS << " trips each ===\n";
+
+    EventLoop loop;
+    std::vector<std::unique_ptr<inheritance::Vehicle>> fleet;
+    std::vector<Task> tasks;
+    fleet.reserve(count);
+    tasks.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        DriveTimes times = CAR_TIMES;
+        if (i % 3 == 0) {
+            bool sidecar = i % 2 == 0;
+            fleet.push_back(std::make_unique<inheritance::Motorcycle>("Honda", 2020, sidecar));
+            times = sidecar ? SIDECAR_TIMES : MOTORCYCLE_TIMES;
+        } else {
+            fleet.push_back(std::make_unique<inheritance::Car>("Toyota", 2023, 4));
+        }
+        // Different trip lengths spread the vehicles over the timer wheel
+        tasks.push_back(drive(loop, *fleet.back(), times, TRIPS, 1000 + (i % 20'000)));
+    }
+
+    std::cout << "Coroutine frame size: " << frames::lastFrameSize << " bytes\n";
+    std::cout << "Frames alive:         " << frames::live << " ("
+              << frames::bytes / 1024 << " KiB)\n";
+
+    // Every start() and stop() prints; nobody reads millions of those lines
+    std::cout.setstate(std::ios::failbit);
+    auto start = std::chrono::steady_clock::now();
+    runAll(loop, tasks);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout.clear();
+
+    std::size_t finished = 0;
+    for (const Task& task : tasks) {
+        finished += task.done();
+    }
+
+    std::cout << "Finished vehicles:    " << finished << "\n";
+    std::cout << "Simulated time:       " << loop.getTime() / 1000 << " s\n";
+    std::cout << "Events processed:     " << loop.getEventCount() << "\n";
+    std::cout << "Events/s:             " << static_cast<long long>(loop.getEventCount() / seconds) << "\n";
+
+    return 0;
+}
@@ -0,0 +1,281 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+// Example: Which virtual call sites are really polymorphic?
+//
+// 02_virtual_functions.cpp dispatches through BaseClass -> DerivedClass ->
+// FurtherDerived. In a real program most virtual call sites only ever see
+// one dynamic type (monomorphic); some see a few (polymorphic); a few see
+// many (megamorphic). Knowing which is which tells us where it is worth
+// devirtualizing, or sorting objects by type before a loop.
+//
+// Wrap a virtual call in VCALL(object, method(args)) to profile it. Build
+// with -DPROFILE_CALLSITES to record the dynamic types seen at each site;
+// without it, VCALL expands to the plain call and costs nothing.
+
+#ifdef PROFILE_CALLSITES
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+// type_info::name() is mangled on GCC/Clang ("14FurtherDerived")
+std::string readableName(const std::type_info& type) {
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr) {
+        std::string name(demangled);
+        std::free(demangled);
+        return name;
+    }
+#endif
+    return type.name();
+}
+
+// One instance per VCALL in the source, created on its first execution.
+// A site may be hit from several threads at once, so the counters are
+// relaxed atomics: each increment is exact, and nothing else is ordered
+// by them. Type slots are claimed with a compare-exchange.
+class CallSite {
+public:
+    static constexpr std::size_t MAX_TYPES = 8;  // beyond this, counted as "other"
+
+private:
+    const char* file;
+    int line;
+    const char* expression;
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> otherCalls{0};
+    std::atomic<const std::type_info*> types[MAX_TYPES] = {};
+    std::atomic<std::uint64_t> counts[MAX_TYPES] = {};
+
+    struct Registry {
+        std::mutex mutex;
+        std::vector<CallSite*> sites;
+    };
+
+    static Registry& registry() {
+        static Registry instance;
+        return instance;
+    }
+
+    std::uint64_t load(const std::atomic<std::uint64_t>& counter) const {
+        return counter.load(std::memory_order_relaxed);
+    }
+
+    // Slots are filled front to back and never emptied
+    std::size_t typeCount() const {
+        std::size_t count = 0;
+        while (count < MAX_TYPES && types[count].load(std::memory_order_acquire) != nullptr) {
+            ++count;
+        }
+        return count;
+    }
+
+public:
+    CallSite(const char* file, int line, const char* expression)
+        : file(file), line(line), expression(expression) {
+        Registry& r = registry();
+        std::lock_guard lock(r.mutex);
+        r.sites.push_back(this);
+    }
+
+    CallSite(const CallSite&) = delete;
+    CallSite& operator=(const CallSite&) = delete;
+
+    void record(const std::type_info& type) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        // Linear search over a handful of pointers: the first entry
+        // nearly always matches at monomorphic sites
+        for (std::size_t i = 0; i < MAX_TYPES; ++i) {
+            const std::type_info* seen = types[i].load(std::memory_order_acquire);
+            if (seen == nullptr &&
+                types[i].compare_exchange_strong(seen, &type, std::memory_order_acq_rel)) {
+                seen = &type;  // claimed the free slot
+            }
+            // Either the slot already held a type, or another thread just
+            // claimed it - possibly for this same type
+            if (*seen == type) {
+                counts[i].fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+        otherCalls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Shannon entropy of the type distribution in bits: 0 for a single
+    // type, log2(n) when n types are equally common
+    // Reports are meant for when the profiled threads are done; while they
+    // still run, the numbers are a consistent-enough snapshot, not exact
+    double entropy() const {
+        double total = static_cast<double>(load(calls));
+        double bits = 0.0;
+        auto add = [&](std::uint64_t count) {
+            if (count > 0) {
+                double p = static_cast<double>(count) / total;
+                bits -= p * std::log2(p);
+            }
+        };
+        for (std::size_t i = 0; i < typeCount(); ++i) {
+            add(load(counts[i]));
+        }
+        add(load(otherCalls));
+        return bits;
+    }
+
+    const char* classify() const {
+        if (load(otherCalls) > 0 || typeCount() > 3) {
+            return "megamorphic";
+        }
+        return typeCount() == 1 ? "monomorphic" : "polymorphic";
+    }
+
+    void print() const {
+        double total = static_cast<double>(load(calls));
+        std::cout << file << ":" << line << "  " << expression << "\n"
+                  << "    " << load(calls) << " calls, " << classify() << ", entropy "
+                  << std::fixed << std::setprecision(2) << entropy() << " bits\n";
+        for (std::size_t i = 0; i < typeCount(); ++i) {
+            std::cout << "      " << std::setw(6) << std::setprecision(1)
+                      << 100.0 * static_cast<double>(load(counts[i])) / total
+                      << "%  " << readableName(*types[i].load(std::memory_order_acquire)) << "\n";
+        }
+        if (load(otherCalls) > 0) {
+            std::cout << "      " << std::setw(6)
+                      << 100.0 * static_cast<double>(load(otherCalls)) / total
+                      << "%  <other types>\n";
+        }
+    }
+
+    // Hottest sites first; among equally hot ones, the most mixed first
+    static void report() {
+        std::vector<CallSite*> sites;
+        {
+            Registry& r = registry();
+            std::lock_guard lock(r.mutex);
+            sites = r.sites;
+        }
+        std::sort(sites.begin(), sites.end(), [](const CallSite* a, const CallSite* b) {
+            if (a->load(a->calls) != b->load(b->calls)) {
+                return a->load(a->calls) > b->load(b->calls);
+            }
+            return a->entropy() > b->entropy();
+        });
+        std::cout << "=== Virtual call-site profile (" << sites.size() << " sites) ===\n";
+        for (const CallSite* site : sites) {
+            site->print();
+        }
+    }
+};
+
+// The lambda gives every expansion of the macro its own static CallSite
+// (initialized once, thread-safely). `object` is evaluated exactly once,
+// as in the unprofiled version, even if it has side effects.
+#define VCALL(object, call)                                                     \
+    ([&]() -> decltype(auto) {                                                  \
+        static CallSite callSite(__FILE__, __LINE__, #object "->" #call);       \
+        auto&& vcallObject = (object);                                          \
+        callSite.record(typeid(*vcallObject));                                  \
+        return vcallObject->call;                                               \
+    }())
+
+#else
+
+#define VCALL(object, call) ((object)->call)
+
+#endif
+
+// ---------------------------------------------------------------------------
+// The hierarchy from 02_virtual_functions.cpp, plus two more leaves so
+// that one site can become megamorphic. Methods count instead of print.
+// ---------------------------------------------------------------------------
+
+namespace counters {
+    std::uint64_t work = 0;
+}
+
+class BaseClass {
+public:
+    virtual ~BaseClass() = default;
+    virtual void method1() { counters::work += 1; }
+    virtual void method2() = 0;
+};
+
+class DerivedClass : public BaseClass {
+public:
+    void method1() override { counters::work += 2; }
+    void method2() override { counters::work += 3; }
+};
+
+class FurtherDerived : public DerivedClass {
+public:
+    void method1() override { counters::work += 4; }
+    void method2() override { counters::work += 5; }
+};
+
+class SiblingDerived : public BaseClass {
+public:
+    void method2() override { counters::work += 6; }
+};
+
+class LeafDerived : public FurtherDerived {
+public:
+    void method2() override { counters::work += 7; }
+};
+
+// Three loops, three kinds of call site
+void runWorkload(const std::vector<std::unique_ptr<BaseClass>>& mixed,
+                 const std::vector<std::unique_ptr<BaseClass>>& pair,
+                 const std::vector<std::unique_ptr<BaseClass>>& uniform) {
+    for (const auto& object : uniform) {
+        VCALL(object, method1());   // only ever FurtherDerived
+    }
+    for (const auto& object : pair) {
+        VCALL(object, method2());   // DerivedClass or FurtherDerived
+    }
+    for (const auto& object : mixed) {
+        VCALL(object, method2());   // every class in the hierarchy
+    }
+}
+
+int main() {
+    std::vector<std::unique_ptr<BaseClass>> mixed, pair, uniform;
+    for (int i = 0; i < 100'000; ++i) {
+        uniform.push_back(std::make_unique<FurtherDerived>());
+        if (i % 4 == 0) {
+            pair.push_back(std::make_unique<DerivedClass>());
+        } else {
+            pair.push_back(std::make_unique<FurtherDerived>());
+        }
+        switch (i % 4) {
+            case 0: mixed.push_back(std::make_unique<DerivedClass>()); break;
+            case 1: mixed.push_back(std::make_unique<FurtherDerived>()); break;
+            case 2: mixed.push_back(std::make_unique<SiblingDerived>()); break;
+            default: mixed.push_back(std::make_unique<LeafDerived>()); break;
+        }
+    }
+
+    for (int round = 0; round < 10; ++round) {
+        runWorkload(mixed, pair, uniform);
+    }
+    std::cout << "Work done: " << counters::work << "\n\n";
+
+#ifdef PROFILE_CALLSITES
+    CallSite::report();
+#else
+    std::cout << "Call-site profiling is compiled out; rebuild with -DPROFILE_CALLSITES\n";
+#endif
+
+    return 0;
+}
@@ -0,0 +1,325 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../common/emplace.h"
+#include "employees.h"
+
+// Example: An indexed employee directory
+//
+// In 03_abstract_classes.cpp the company is a vector of employees and the
+// only query is getName(), so finding someone means scanning the whole
+// vector. That is fine for four people and hopeless for millions.
+//
+// The directory below keeps the same objects (employees.h) but adds
+// indexes over them:
+//   - a hash index for exact name lookups,
+//   - a sorted table of names for prefix searches ("everyone starting with
+//     'Ali'"), which is a binary search instead of a scan,
+//   - one list per role, so "all managers" does not touch anyone else.
+// The indexes hold std::string_view keys pointing at the names the
+// employees already own, and every query takes a std::string_view, so no
+// temporary std::string is ever created to look something up.
+
+enum class Role : std::uint8_t { Engineer, Manager, Designer };
+constexpr std::size_t ROLE_COUNT = 3;
+
+const char* roleName(Role role) {
+    switch (role) {
+        case Role::Engineer: return "Engineer";
+        case Role::Manager: return "Manager";
+        case Role::Designer: return "Designer";
+    }
+    return "?";
+}
+
+using inheritance::Designer;
+using inheritance::Employee;
+using inheritance::Engineer;
+using inheritance::Manager;
+
+// The role index needs each employee's concrete class. The hierarchy has
+// no virtual for it, so ask the object: this runs once per employee, at
+// load time, never during a query.
+Role roleOf(const Employee& employee) {
+    if (dynamic_cast<const Manager*>(&employee)) {
+        return Role::Manager;
+    }
+    if (dynamic_cast<const Designer*>(&employee)) {
+        return Role::Designer;
+    }
+    return Role::Engineer;
+}
+
+// ---------------------------------------------------------------------------
+// The directory
+// ---------------------------------------------------------------------------
+
+class EmployeeDirectory {
+private:
+    struct Entry {
+        std::string_view name;  // points into employees[id]->name
+        std::uint32_t id;
+    };
+
+    std::vector<std::unique_ptr<Employee>> employees;
+    std::unordered_map<std::string_view, std::uint32_t> byName;
+    std::vector<Entry> sortedNames;                           // ordered by name
+    std::array<std::vector<std::uint32_t>, ROLE_COUNT> byRole;  // ids, in name order
+
+    // End of the run of names beginning with `prefix` that starts at `first`.
+    // Comparing only the first prefix.size() characters keeps the names in
+    // that run "equal", so a binary search finds where it ends.
+    std::vector<Entry>::const_iterator prefixEnd(std::vector<Entry>::const_iterator first,
+                                                 std::string_view prefix) const {
+        return std::partition_point(first, sortedNames.end(), [&](const Entry& entry) {
+            return entry.name.compare(0, prefix.size(), prefix) <= 0;
+        });
+    }
+
+public:
+    // Bulk load: takes all employees at once and builds every index in one
+    // pass each, instead of keeping the indexes sorted during insertion.
+    // The directory owns the employees afterwards, so the string_views in
+    // the indexes stay valid for its lifetime.
+    void load(std::vector<std::unique_ptr<Employee>> staff) {
+        employees = std::move(staff);
+        byName.clear();
+        sortedNames.clear();
+        for (auto& ids : byRole) {
+            ids.clear();
+        }
+
+        byName.reserve(employees.size());
+        sortedNames.reserve(employees.size());
+        for (std::uint32_t id = 0; id < employees.size(); ++id) {
+            std::string_view name = employees[id]->getName();
+            byName.emplace(name, id);  // keeps the first of duplicate names
+            sortedNames.push_back({name, id});
+        }
+        std::sort(sortedNames.begin(), sortedNames.end(), [](const Entry& a, const Entry& b) {
+            return a.name < b.name;
+        });
+
+        for (const Entry& entry : sortedNames) {
+            byRole[static_cast<std::size_t>(roleOf(*employees[entry.id]))].push_back(entry.id);
+        }
+    }
+
+    std::size_t size() const { return employees.size(); }
+
+    // Exact lookup; nullptr when nobody has that name
+    const Employee* find(std::string_view name) const {
+        auto it = byName.find(name);
+        return it == byName.end() ? nullptr : employees[it->second].get();
+    }
+
+    // Calls fn for every employee whose name starts with `prefix`, in name order
+    template <typename Function>
+    void forEachWithPrefix(std::string_view prefix, Function fn) const {
+        auto first = std::lower_bound(sortedNames.begin(), sortedNames.end(), prefix,
+                                      [](const Entry& entry, std::string_view value) {
+                                          return entry.name < value;
+                                      });
+        auto last = prefixEnd(first, prefix);
+        for (auto it = first; it != last; ++it) {
+            fn(*employees[it->id]);
+        }
+    }
+
+    std::size_t countWithPrefix(std::string_view prefix) const {
+        std::size_t count = 0;
+        forEachWithPrefix(prefix, [&](const Employee&) { ++count; });
+        return count;
+    }
+
+    // Calls fn for every employee with the given role, in name order
+    template <typename Function>
+    void forEachWithRole(Role role, Function fn) const {
+        for (std::uint32_t id : byRole[static_cast<std::size_t>(role)]) {
+            fn(*employees[id]);
+        }
+    }
+
+    std::size_t countWithRole(Role role) const {
+        return byRole[static_cast<std::size_t>(role)].size();
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Linear scans over a plain vector, as in 03_abstract_classes.cpp
+// ---------------------------------------------------------------------------
+
+const Employee* scanFind(const std::vector<const Employee*>& company, std::string_view name) {
+    for (const Employee* employee : company) {
+        if (employee->getName() == name) {
+            return employee;
+        }
+    }
+    return nullptr;
+}
+
+std::size_t scanCountWithPrefix(const std::vector<const Employee*>& company, std::string_view prefix) {
+    std::size_t count = 0;
+    for (const Employee* employee : company) {
+        count += std::string_view(employee->getName()).substr(0, prefix.size()) == prefix;
+    }
+    return count;
+}
+
+// ---------------------------------------------------------------------------
+// Test data
+// ---------------------------------------------------------------------------
+
+constexpr std::array<const char*, 8> FIRST_NAMES = {
+    "Alice", "Bob", "Charlie", "David", "Eve", "Frank", "Grace", "Heidi"};
+
+// "Alice 0000042": unique names that share plenty of prefixes
+std::string makeName(std::size_t i) {
+    std::string digits = std::to_string(i / FIRST_NAMES.size());
+    return std::string(FIRST_NAMES[i % FIRST_NAMES.size()]) + " " +
+           std::string(7 - std::min<std::size_t>(7, digits.size()), '0') + digits;
+}
+
+std::vector<std::unique_ptr<Employee>> makeStaff(std::size_t count) {
+    std::vector<std::unique_ptr<Employee>> staff;
+    staff.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string name = makeName(i);
+        switch (i % 10) {
+            case 0: emplace<Manager>(staff, std::move(name)); break;
+            case 1:
+            case 2: emplace<Designer>(staff, std::move(name)); break;
+            default: emplace<Engineer>(staff, std::move(name)); break;
+        }
+    }
+    return staff;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    // The small company from 03_abstract_classes.cpp
+    {
+        std::vector<std::unique_ptr<Employee>> company;
+        emplace<Engineer>(company, "Alice");
+        emplace<Manager>(company, "Bob");
+        emplace<Designer>(company, "Charlie");
+        emplace<Engineer>(company, "David");
+        emplace<Engineer>(company, "Alina");
+
+        EmployeeDirectory directory;
+        directory.load(std::move(company));
+
+        std::cout << "=== Company Directory ===\n";
+        if (const Employee* bob = directory.find("Bob")) {
+            std::cout << "find(\"Bob\"): " << roleName(roleOf(*bob)) << ", ";
+            bob->getSalary();
+        }
+        std::cout << "find(\"Mallory\"): " << (directory.find("Mallory") ? "found" : "not found") << "\n";
+
+        std::cout << "Names starting with \"Ali\":\n";
+        directory.forEachWithPrefix("Ali", [](const Employee& employee) {
+            std::cout << "  - " << employee.getName() << "\n";
+        });
+
+        std::cout << "Engineers at work:\n";
+        directory.forEachWithRole(Role::Engineer, [](const Employee& employee) {
+            std::cout << "  - ";
+            employee.work();
+        });
+    }
+
+    // Usage: inheritance_06_directory [employees]
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 200'000;
+    constexpr std::size_t POINT_QUERIES = 1'000;
+    constexpr std::size_t PREFIX_QUERIES = 100;
+
+    std::cout << "\n=== " << count << " employees ===\n";
+    std::cout << std::fixed << std::setprecision(1);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::unique_ptr<Employee>> staff = makeStaff(count);
+    std::cout << "Create objects:     " << secondsSince(start) * 1e3 << " ms\n";
+
+    // The scan baseline looks at the same objects the directory owns
+    std::vector<const Employee*> company;
+    company.reserve(staff.size());
+    for (const auto& employee : staff) {
+        company.push_back(employee.get());
+    }
+
+    EmployeeDirectory directory;
+    start = std::chrono::steady_clock::now();
+    directory.load(std::move(staff));
+    std::cout << "Bulk load indexes:  " << secondsSince(start) * 1e3 << " ms\n";
+
+    // Query names spread across the whole directory
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < POINT_QUERIES; ++i) {
+        names.push_back(makeName((i * 7919) % count));
+    }
+    // Dropping the last two digits ("Grace 00012") matches up to 100 people,
+    // whatever the directory size
+    std::vector<std::string> prefixes;
+    for (std::size_t i = 0; i < PREFIX_QUERIES; ++i) {
+        std::string name = makeName((i * 7919) % count);
+        prefixes.push_back(name.substr(0, name.size() - 2));
+    }
+
+    std::size_t checksum = 0;
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& name : names) {
+        checksum += directory.find(name) != nullptr;
+    }
+    double indexedPoint = secondsSince(start) / POINT_QUERIES;
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& name : names) {
+        checksum += scanFind(company, name) != nullptr;
+    }
+    double scanPoint = secondsSince(start) / POINT_QUERIES;
+
+    std::size_t indexedMatches = 0;
+    start = std::chrono::steady_clock::now();
+    for (const auto& prefix : prefixes) {
+        indexedMatches += directory.countWithPrefix(prefix);
+    }
+    double indexedPrefix = secondsSince(start) / PREFIX_QUERIES;
+
+    std::size_t scanMatches = 0;
+    start = std::chrono::steady_clock::now();
+    for (const auto& prefix : prefixes) {
+        scanMatches += scanCountWithPrefix(company, prefix);
+    }
+    double scanPrefix = secondsSince(start) / PREFIX_QUERIES;
+
+    std::cout << "\n=== Query latency ===\n";
+    std::cout << "Exact name, hash index:   " << indexedPoint * 1e6 << " us\n";
+    std::cout << "Exact name, linear scan:  " << scanPoint * 1e6 << " us\n";
+    std::cout << "Prefix, sorted table:     " << indexedPrefix * 1e6 << " us\n";
+    std::cout << "Prefix, linear scan:      " << scanPrefix * 1e6 << " us\n";
+    std::cout << "Managers / Designers / Engineers: " << directory.countWithRole(Role::Manager) << " / "
+              << directory.countWithRole(Role::Designer) << " / "
+              << directory.countWithRole(Role::Engineer) << "\n";
+
+    if (indexedMatches != scanMatches || checksum != 2 * POINT_QUERIES) {
+        std::cout << "Index and scan disagree!\n";
+        return 1;
+    }
+    std::cout << "Index and scan agree (" << indexedMatches << " prefix matches)\n";
+
+    return 0;
+}
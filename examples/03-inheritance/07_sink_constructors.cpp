@@ -0,0 +1,343 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../common/emplace.h"
+#include "../common/allocation_tracker.h"
+#include "employees.h"
+
+// Example: Sink parameters - constructors that take by value and move
+//
+// Constructors such as Employee(const std::string& name) in
+// 03_abstract_classes.cpp copy their argument into a member. When the
+// caller passes a temporary - a name just parsed from input - that copy is
+// a second allocation for text that was about to be thrown away.
+//
+// Two fixes, both now used by the examples' constructors:
+//   - by value and move: Employee(std::string name) : name(std::move(name)).
+//     A temporary is moved all the way into the member, an lvalue is copied
+//     once, exactly as before. Each level of the hierarchy adds one cheap move.
+//   - perfect forwarding: a template constructor passes the argument on
+//     untouched, so even the extra moves disappear - at the price of a
+//     template and a constraint (see below).
+//
+// CountedString counts copies and moves so we can check those claims; the
+// benchmark counts heap allocations while building employees from text.
+// The real classes (employees.h and the other shared headers) take their
+// strings by value, and emplace() from common/emplace.h builds them in place.
+
+// ---------------------------------------------------------------------------
+// A string that counts how it is copied and moved
+// ---------------------------------------------------------------------------
+
+namespace counters {
+    std::size_t copies = 0;
+    std::size_t moves = 0;
+}
+
+class CountedString {
+private:
+    std::string text;
+
+public:
+    CountedString(const char* text) : text(text) {}
+    CountedString(std::string text) : text(std::move(text)) {}
+
+    CountedString(const CountedString& other) : text(other.text) { ++counters::copies; }
+    CountedString(CountedString&& other) noexcept : text(std::move(other.text)) { ++counters::moves; }
+    CountedString& operator=(const CountedString& other) {
+        text = other.text;
+        ++counters::copies;
+        return *this;
+    }
+    CountedString& operator=(CountedString&& other) noexcept {
+        text = std::move(other.text);
+        ++counters::moves;
+        return *this;
+    }
+
+    const std::string& str() const { return text; }
+};
+
+// ---------------------------------------------------------------------------
+// The same small hierarchy, three ways
+// ---------------------------------------------------------------------------
+
+// As the examples used to be: always copies
+namespace byReference {
+
+class Employee {
+protected:
+    CountedString name;
+
+public:
+    Employee(const CountedString& name) : name(name) {}
+    virtual ~Employee() = default;
+    virtual double getSalary() const = 0;
+    const std::string& getName() const { return name.str(); }
+};
+
+class Engineer : public Employee {
+public:
+    Engineer(const CountedString& name) : Employee(name) {}
+    double getSalary() const override { return 80000.0; }
+};
+
+class Manager : public Employee {
+public:
+    Manager(const CountedString& name) : Employee(name) {}
+    double getSalary() const override { return 100000.0; }
+};
+
+}  // namespace byReference
+
+// As the examples are now: one copy for lvalues, none for temporaries
+namespace byValue {
+
+class Employee {
+protected:
+    CountedString name;
+
+public:
+    Employee(CountedString name) : name(std::move(name)) {}
+    virtual ~Employee() = default;
+    virtual double getSalary() const = 0;
+    const std::string& getName() const { return name.str(); }
+};
+
+class Engineer : public Employee {
+public:
+    Engineer(CountedString name) : Employee(std::move(name)) {}
+    double getSalary() const override { return 80000.0; }
+};
+
+class Manager : public Employee {
+public:
+    Manager(CountedString name) : Employee(std::move(name)) {}
+    double getSalary() const override { return 100000.0; }
+};
+
+}  // namespace byValue
+
+// Forwards whatever it is given straight to the member. The constraint
+// matters: without it, copying a non-const Engineer would pick this
+// template over the copy constructor and try to make a name from an Engineer.
+namespace forwarding {
+
+template <typename Name>
+using IfName = std::enable_if_t<std::is_constructible_v<CountedString, Name&&>>;
+
+class Employee {
+protected:
+    CountedString name;
+
+public:
+    template <typename Name, typename = IfName<Name>>
+    Employee(Name&& name) : name(std::forward<Name>(name)) {}
+    virtual ~Employee() = default;
+    virtual double getSalary() const = 0;
+    const std::string& getName() const { return name.str(); }
+};
+
+class Engineer : public Employee {
+public:
+    template <typename Name, typename = IfName<Name>>
+    Engineer(Name&& name) : Employee(std::forward<Name>(name)) {}
+    double getSalary() const override { return 80000.0; }
+};
+
+class Manager : public Employee {
+public:
+    template <typename Name, typename = IfName<Name>>
+    Manager(Name&& name) : Employee(std::forward<Name>(name)) {}
+    double getSalary() const override { return 100000.0; }
+};
+
+}  // namespace forwarding
+
+// ---------------------------------------------------------------------------
+// Copy/move checks
+// ---------------------------------------------------------------------------
+
+struct Counts {
+    std::size_t copies;
+    std::size_t moves;
+};
+
+template <typename Function>
+Counts count(Function function) {
+    counters::copies = 0;
+    counters::moves = 0;
+    function();
+    return {counters::copies, counters::moves};
+}
+
+std::size_t failedChecks = 0;
+
+void expect(const char* style, const char* argument, Counts actual, Counts expected) {
+    bool ok = actual.copies == expected.copies && actual.moves == expected.moves;
+    failedChecks += !ok;
+    std::cout << std::left << std::setw(14) << style << std::setw(20) << argument << std::right
+              << std::setw(7) << actual.copies << std::setw(7) << actual.moves
+              << (ok ? "" : "   FAIL (expected different counts)") << "\n";
+}
+
+// Engineer built from a temporary, an lvalue and an explicitly moved lvalue
+template <typename Engineer>
+void checkStyle(const char* style, Counts fromTemporary, Counts fromLvalue, Counts fromMoved) {
+    expect(style, "temporary", count([] { Engineer engineer(CountedString("Alice Johnson-Smith")); }),
+           fromTemporary);
+    CountedString name("Alice Johnson-Smith");
+    expect(style, "lvalue", count([&] { Engineer engineer(name); }), fromLvalue);
+    expect(style, "std::move(lvalue)", count([&] { Engineer engineer(std::move(name)); }), fromMoved);
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark: building employees from parsed text
+// ---------------------------------------------------------------------------
+
+// "Engineer,Alice Johnson 0000042" - names longer than the small-string
+// buffer, so every std::string holding one is a heap allocation
+std::string makeInput(std::size_t lines) {
+    const char* firstNames[] = {"Alice", "Bob", "Charlie", "David"};
+    std::string input;
+    for (std::size_t i = 0; i < lines; ++i) {
+        std::string number = std::to_string(i);
+        input += (i % 5 == 0) ? "Manager," : "Engineer,";
+        input += firstNames[i % 4];
+        input += " Johnson ";
+        input += std::string(7 - number.size(), '0') + number;
+        input += '\n';
+    }
+    return input;
+}
+
+struct Record {
+    std::string_view role;
+    std::string_view name;
+};
+
+std::vector<Record> splitLines(std::string_view input) {
+    std::vector<Record> records;
+    while (!input.empty()) {
+        std::size_t end = input.find('\n');
+        std::string_view line = input.substr(0, end);
+        std::size_t comma = line.find(',');
+        records.push_back({line.substr(0, comma), line.substr(comma + 1)});
+        input.remove_prefix(end == std::string_view::npos ? input.size() : end + 1);
+    }
+    return records;
+}
+
+struct BuildResult {
+    double seconds;
+    allocation::Stats stats;
+};
+
+// Builds `count` employees, each from a freshly parsed std::string name,
+// as a parser handing out strings would. Objects are kept in batches so
+// memory stays bounded however many are built.
+template <typename Employee, typename Engineer, typename Manager>
+BuildResult build(const std::vector<Record>& records, std::size_t count, const char* label) {
+    constexpr std::size_t BATCH = 100'000;
+    std::vector<std::unique_ptr<Employee>> batch;
+    batch.reserve(BATCH);
+
+    allocation::Scope scope(label);
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        const Record& record = records[i % records.size()];
+        std::string name(record.name);  // the parsed field
+        if (record.role == "Manager") {
+            emplace<Manager>(batch, std::move(name));
+        } else {
+            emplace<Engineer>(batch, std::move(name));
+        }
+        if (batch.size() == BATCH) {
+            batch.clear();
+        }
+    }
+    batch.clear();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    scope.report();
+    return {seconds, scope.stats()};
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "=== Copies and moves of the name while constructing an Engineer ===\n";
+    std::cout << std::left << std::setw(14) << "style" << std::setw(20) << "argument" << std::right
+              << std::setw(7) << "copies" << std::setw(7) << "moves" << "\n";
+    checkStyle<byReference::Engineer>("const&", {1, 0}, {1, 0}, {1, 0});
+    checkStyle<byValue::Engineer>("by value", {0, 2}, {1, 2}, {0, 3});
+    checkStyle<forwarding::Engineer>("forwarding", {0, 1}, {1, 0}, {0, 1});
+
+    // Copying still works with the forwarding constructors in the way
+    forwarding::Engineer original("Grace Hopper-Smith");
+    forwarding::Engineer copy = original;
+    std::cout << "Copied forwarding::Engineer: " << copy.getName() << "\n";
+
+    std::cout << "\n=== emplace-style factory ===\n";
+    std::vector<std::unique_ptr<byValue::Employee>> company;
+    Counts hiring = count([&] {
+        emplace<byValue::Engineer>(company, "Alice Johnson-Smith");
+        emplace<byValue::Manager>(company, std::string("Bob Williams-Jones"));
+    });
+    for (const auto& employee : company) {
+        std::cout << employee->getName() << ": $" << employee->getSalary() << "\n";
+    }
+    std::cout << "Copies while hiring: " << hiring.copies << "\n";
+    failedChecks += hiring.copies != 0;
+
+    // The same with the real classes from 03_abstract_classes.cpp: a parsed
+    // name moves into the member, so the object is the only allocation
+    std::vector<std::unique_ptr<inheritance::Employee>> staff;
+    staff.reserve(1);
+    std::string parsed = "Grace Hopper-Smith, Engineer";
+    parsed.resize(parsed.find(','));
+    {
+        allocation::Scope scope("emplace<inheritance::Engineer>");
+        inheritance::Engineer& engineer = emplace<inheritance::Engineer>(staff, std::move(parsed));
+        scope.report();
+        failedChecks += !allocation::expectAtMost(scope, 1, "real Engineer from a parsed name");
+        std::cout << "Hired " << engineer.getName() << "\n";
+    }
+
+    // Usage: inheritance_07_sink [objects]
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1'000'000;
+    std::string input = makeInput(10'000);
+    std::vector<Record> records = splitLines(input);
+
+    std::cout << "\n=== Building " << count << " employees from parsed input ===" << std::endl;
+    BuildResult copied = build<byReference::Employee, byReference::Engineer, byReference::Manager>(
+        records, count, "const& constructors");
+    BuildResult moved = build<byValue::Employee, byValue::Engineer, byValue::Manager>(
+        records, count, "by-value constructors");
+    BuildResult forwarded = build<forwarding::Employee, forwarding::Engineer, forwarding::Manager>(
+        records, count, "forwarding constructors");
+
+    auto perObject = [count](const BuildResult& result) {
+        return static_cast<double>(result.stats.allocations) / static_cast<double>(count);
+    };
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "const&:     " << perObject(copied) << " allocations/object, "
+              << copied.seconds * 1e9 / count << " ns/object\n";
+    std::cout << "by value:   " << perObject(moved) << " allocations/object, "
+              << moved.seconds * 1e9 / count << " ns/object\n";
+    std::cout << "forwarding: " << perObject(forwarded) << " allocations/object, "
+              << forwarded.seconds * 1e9 / count << " ns/object\n";
+
+    // Parsed name + object; the const& version adds the member's copy
+    bool ok = copied.stats.allocations == 3 * count && moved.stats.allocations == 2 * count &&
+              forwarded.stats.allocations == 2 * count;
+    std::cout << (ok ? "PASS" : "FAIL") << ": sink constructors save one allocation per object\n";
+    failedChecks += !ok;
+
+    return failedChecks == 0 ? 0 : 1;
+}
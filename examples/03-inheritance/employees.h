@@ -0,0 +1,83 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "../common/layout_fields.h"
+
+// Employee hierarchy from 03_abstract_classes.cpp.
+
+namespace inheritance {
+
+// Abstract base class (interface)
+class Employee {
+protected:
+    std::string name;
+    LAYOUT_FIELDS(Employee, name)
+    
+public:
+    Employee(std::string name) : name(std::move(name)) {}
+    
+    virtual ~Employee() = default;
+    
+    virtual void work() const = 0;
+    virtual void getSalary() const = 0;
+    
+    const std::string& getName() const {
+        return name;
+    }
+};
+
+class Engineer : public Employee {
+private:
+    double salary = 80000.0;
+    LAYOUT_DERIVED_FIELDS(Engineer, Employee, salary)
+    
+public:
+    Engineer(std::string name) : Employee(std::move(name)) {}
+    
+    void work() const override {
+        std::cout << name << " is writing code and debugging\n";
+    }
+    
+    void getSalary() const override {
+        std::cout << name << "'s salary: $" << salary << std::endl;
+    }
+};
+
+class Manager : public Employee {
+private:
+    double salary = 100000.0;
+    LAYOUT_DERIVED_FIELDS(Manager, Employee, salary)
+    
+public:
+    Manager(std::string name) : Employee(std::move(name)) {}
+    
+    void work() const override {
+        std::cout << name << " is managing the team\n";
+    }
+    
+    void getSalary() const override {
+        std::cout << name << "'s salary: $" << salary << std::endl;
+    }
+};
+
+class Designer : public Employee {
+private:
+    double salary = 75000.0;
+    LAYOUT_DERIVED_FIELDS(Designer, Employee, salary)
+    
+public:
+    Designer(std::string name) : Employee(std::move(name)) {}
+    
+    void work() const override {
+        std::cout << name << " is designing user interfaces\n";
+    }
+    
+    void getSalary() const override {
+        std::cout << name << "'s salary: $" << salary << std::endl;
+    }
+};
+
+}  // namespace inheritance
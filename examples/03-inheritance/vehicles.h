@@ -0,0 +1,99 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "../common/layout_fields.h"
+
+// Vehicle hierarchy from 01_basic_inheritance.cpp.
+
+namespace inheritance {
+
+// Base class: Vehicle
+class Vehicle {
+protected:
+    // Protected: accessible to derived classes
+    std::string brand;
+    int year;
+    LAYOUT_FIELDS(Vehicle, brand, year)
+    
+public:
+    // Constructor with member initializer list
+    Vehicle(std::string brand, int year)
+        : brand(std::move(brand)), year(year) {}
+    
+    // Virtual destructor - REQUIRED for polymorphic classes
+    virtual ~Vehicle() = default;
+    
+    // Virtual methods that can be overridden
+    virtual void start() {
+        std::cout << brand << " vehicle starting...\n";
+    }
+    
+    virtual void stop() {
+        std::cout << brand << " vehicle stopping...\n";
+    }
+    
+    // Non-virtual method - same implementation everywhere
+    void printInfo() const {
+        std::cout << "Brand: " << brand << ", Year: " << year << std::endl;
+    }
+};
+
+// Derived class: Car
+class Car : public Vehicle {
+private:
+    int numberOfDoors;
+    LAYOUT_DERIVED_FIELDS(Car, Vehicle, numberOfDoors)
+    
+public:
+    // Constructor calling base class constructor
+    Car(std::string brand, int year, int doors)
+        : Vehicle(std::move(brand), year), numberOfDoors(doors) {}
+    
+    ~Car() override = default;
+    
+    // Override virtual methods
+    void start() override {
+        std::cout << brand << " car with " << numberOfDoors 
+                  << " doors starting...\n";
+    }
+    
+    void stop() override {
+        std::cout << brand << " car is parking...\n";
+    }
+    
+    // Car-specific method
+    void openTrunk() const {
+        std::cout << "Trunk opened\n";
+    }
+};
+
+// Derived class: Motorcycle
+class Motorcycle : public Vehicle {
+private:
+    bool hasSidecar;
+    LAYOUT_DERIVED_FIELDS(Motorcycle, Vehicle, hasSidecar)
+    
+public:
+    Motorcycle(std::string brand, int year, bool hasSidecar)
+        : Vehicle(std::move(brand), year), hasSidecar(hasSidecar) {}
+    
+    ~Motorcycle() override = default;
+    
+    void start() override {
+        std::cout << brand << " motorcycle engine roaring...\n";
+    }
+    
+    void stop() override {
+        std::cout << brand << " motorcycle stopped\n";
+    }
+    
+    // Motorcycle-specific method
+    void wheelie() const {
+        std::cout << "Performing a wheelie!\n";
+    }
+};
+
+}  // namespace inheritance
@@ -1,47 +1,14 @@
 #include <iostream>
 #include <typeinfo>
 
-// Example: Understanding virtual tables (vtables)
-class Shape {
-public:
-    virtual ~Shape() = default;
-    virtual void draw() const = 0;
-    virtual void rotate(int degrees) const = 0;
-};
-
-class Circle : public Shape {
-public:
-    void draw() const override {
-        std::cout << "Drawing circle\n";
-    }
-    
-    void rotate(int degrees) const override {
-        std::cout << "Rotating circle " << degrees << " degrees\n";
-        std::cout << "(Note: rotation has no visual effect on circle)\n";
-    }
-};
+#include "vtable_shapes.h"
 
-class Square : public Shape {
-public:
-    void draw() const override {
-        std::cout << "Drawing square\n";
-    }
-    
-    void rotate(int degrees) const override {
-        std::cout << "Rotating square " << degrees << " degrees\n";
-    }
-};
+// Example: Understanding virtual tables (vtables)
 
-class Triangle : public Shape {
-public:
-    void draw() const override {
-        std::cout << "Drawing triangle\n";
-    }
-    
-    void rotate(int degrees) const override {
-        std::cout << "Rotating triangle " << degrees << " degrees\n";
-    }
-};
+using polymorphism::Shape;
+using polymorphism::Circle;
+using polymorphism::Square;
+using polymorphism::Triangle;
 
 int main() {
     Circle circle;
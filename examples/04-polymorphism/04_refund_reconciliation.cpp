@@ -0,0 +1,637 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Example: Reconciling payments and refunds recorded by polymorphic processors
+//
+// PaymentProcessor::refund() in 02_payment_processors.cpp is fire-and-forget:
+// nothing remembers what was refunded. Here every processor writes what it
+// does into a ledger, and a reconciler matches refunds against payments.
+//
+// The reconciler sorts both streams by transaction ID with an LSD radix sort
+// and walks them side by side (a merge-join). Streams larger than the memory
+// budget are spilled to disk as sorted runs and merged back (external sort).
+
+enum class ProcessorType : std::uint8_t { CreditCard, PayPal, ApplePay };
+constexpr std::size_t PROCESSOR_TYPE_COUNT = 3;
+
+const char* toString(ProcessorType type) {
+    switch (type) {
+        case ProcessorType::CreditCard: return "Credit Card";
+        case ProcessorType::PayPal:     return "PayPal";
+        case ProcessorType::ApplePay:   return "Apple Pay";
+    }
+    return "Unknown";
+}
+
+// One ledger entry - 16 bytes, so a cache line holds four of them
+struct LedgerRecord {
+    std::uint64_t transactionId;
+    std::int64_t amountCents;
+};
+
+// ---------------------------------------------------------------------------
+// Sorting
+// ---------------------------------------------------------------------------
+
+// LSD radix sort on the transaction ID, 16 bits per pass.
+// Passes where every key has the same digit are skipped, so small IDs
+// only pay for the passes they need.
+void radixSort(std::vector<LedgerRecord>& records, std::vector<LedgerRecord>& scratch) {
+    constexpr int DIGIT_BITS = 16;
+    constexpr std::size_t BUCKETS = std::size_t{1} << DIGIT_BITS;
+
+    scratch.resize(records.size());
+    std::vector<std::size_t> counts(BUCKETS);
+
+    for (int shift = 0; shift < 64; shift += DIGIT_BITS) {
+        std::fill(counts.begin(), counts.end(), 0);
+        for (const auto& record : records) {
+            ++counts[(record.transactionId >> shift) & (BUCKETS - 1)];
+        }
+
+        // Every key landed in one bucket: this digit cannot reorder anything
+        if (!records.empty() &&
+            counts[(records.front().transactionId >> shift) & (BUCKETS - 1)] == records.size()) {
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for (auto& count : counts) {
+            std::size_t bucketSize = count;
+            count = offset;
+            offset += bucketSize;
+        }
+        for (const auto& record : records) {
+            scratch[counts[(record.transactionId >> shift) & (BUCKETS - 1)]++] = record;
+        }
+        records.swap(scratch);
+    }
+}
+
+// Reads records back from a sorted run spilled to a temporary file
+class RunReader {
+private:
+    std::FILE* file;
+    std::vector<LedgerRecord> buffer;
+    std::size_t position = 0;
+
+    void refill() {
+        buffer.resize(buffer.capacity());
+        std::size_t read = std::fread(buffer.data(), sizeof(LedgerRecord), buffer.size(), file);
+        buffer.resize(read);
+        position = 0;
+    }
+
+public:
+    RunReader(std::FILE* file, std::size_t bufferRecords) : file(file) {
+        std::rewind(file);
+        buffer.reserve(bufferRecords);
+        refill();
+    }
+
+    ~RunReader() {
+        std::fclose(file);
+    }
+
+    RunReader(const RunReader&) = delete;
+    RunReader& operator=(const RunReader&) = delete;
+
+    bool empty() const { return position == buffer.size(); }
+    const LedgerRecord& front() const { return buffer[position]; }
+
+    void pop() {
+        if (++position == buffer.size()) {
+            refill();
+        }
+    }
+};
+
+// Collects records and hands them back sorted by transaction ID.
+// Keeps at most `memoryBudget` records in RAM; the rest live in sorted runs.
+//
+// Runs are kept in levels, as in a log-structured merge tree: level 0 holds
+// runs spilled from memory, and once a level has MERGE_FANIN runs they are
+// merged into one run on the next level. Only runs of similar size are
+// merged, so every record is rewritten once per level - about
+// log16(records / memoryBudget) times in total - and fewer than MERGE_FANIN
+// runs (file descriptors) stay open per level.
+class ExternalSorter {
+private:
+    static constexpr std::size_t MERGE_FANIN = 16;
+
+    std::size_t memoryBudget;
+    std::vector<LedgerRecord> buffer;
+    std::vector<LedgerRecord> scratch;
+    std::vector<std::vector<std::FILE*>> levels;
+    std::size_t spilledRuns = 0;
+    std::size_t mergePasses = 0;
+    std::size_t mergedRecords = 0;
+
+    // Merge state, filled in by finish()
+    std::vector<std::unique_ptr<RunReader>> readers;
+    std::size_t bufferPosition = 0;
+
+    struct HeapEntry {
+        std::uint64_t transactionId;
+        std::size_t source;  // reader index, or readers.size() for the in-memory tail
+        bool operator>(const HeapEntry& other) const {
+            return transactionId > other.transactionId;
+        }
+    };
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<>> heap;
+
+    static void write(std::FILE* run, const std::vector<LedgerRecord>& records) {
+        if (std::fwrite(records.data(), sizeof(LedgerRecord), records.size(), run) != records.size()) {
+            std::fclose(run);
+            throw std::runtime_error("Cannot write sorted run to temporary file");
+        }
+    }
+
+    static std::FILE* openRun() {
+        std::FILE* run = std::tmpfile();
+        if (run == nullptr) {
+            throw std::runtime_error("Cannot create temporary file for a sorted run");
+        }
+        return run;
+    }
+
+    void spill() {
+        radixSort(buffer, scratch);
+        std::FILE* run = openRun();
+        write(run, buffer);
+        if (levels.empty()) {
+            levels.emplace_back();
+        }
+        levels[0].push_back(run);
+        ++spilledRuns;
+        buffer.clear();
+
+        // A full level becomes one run on the next, which may fill that one
+        for (std::size_t level = 0; levels[level].size() == MERGE_FANIN; ++level) {
+            std::FILE* merged = mergeRuns(levels[level]);
+            if (level + 1 == levels.size()) {
+                levels.emplace_back();
+            }
+            levels[level + 1].push_back(merged);
+        }
+    }
+
+    // Merges `runs` (closing them and clearing the list) into a new run
+    std::FILE* mergeRuns(std::vector<std::FILE*>& runs) {
+        std::size_t perRun = std::max<std::size_t>(memoryBudget / (runs.size() + 1), 256);
+        std::vector<std::unique_ptr<RunReader>> sources;
+        for (std::FILE* run : runs) {
+            sources.push_back(std::make_unique<RunReader>(run, perRun));
+        }
+        runs.clear();
+
+        std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<>> queue;
+        for (std::size_t source = 0; source < sources.size(); ++source) {
+            if (!sources[source]->empty()) {
+                queue.push({sources[source]->front().transactionId, source});
+            }
+        }
+
+        std::FILE* merged = openRun();
+        std::vector<LedgerRecord> output;
+        output.reserve(perRun);
+        while (!queue.empty()) {
+            std::size_t source = queue.top().source;
+            queue.pop();
+            output.push_back(sources[source]->front());
+            sources[source]->pop();
+            ++mergedRecords;
+            if (!sources[source]->empty()) {
+                queue.push({sources[source]->front().transactionId, source});
+            }
+            if (output.size() == perRun) {
+                write(merged, output);
+                output.clear();
+            }
+        }
+        write(merged, output);
+        ++mergePasses;
+        return merged;
+    }
+
+    void pushSource(std::size_t source) {
+        if (source < readers.size()) {
+            if (!readers[source]->empty()) {
+                heap.push({readers[source]->front().transactionId, source});
+            }
+        } else if (bufferPosition < buffer.size()) {
+            heap.push({buffer[bufferPosition].transactionId, source});
+        }
+    }
+
+public:
+    explicit ExternalSorter(std::size_t memoryBudget) : memoryBudget(memoryBudget) {
+        buffer.reserve(std::min<std::size_t>(memoryBudget, 1 << 16));
+    }
+
+    ~ExternalSorter() {
+        // Runs not yet handed to a reader are still ours to close
+        for (const auto& level : levels) {
+            for (std::FILE* run : level) {
+                std::fclose(run);
+            }
+        }
+    }
+
+    ExternalSorter(const ExternalSorter&) = delete;
+    ExternalSorter& operator=(const ExternalSorter&) = delete;
+
+    void add(const LedgerRecord& record) {
+        buffer.push_back(record);
+        if (buffer.size() >= memoryBudget) {
+            spill();
+        }
+    }
+
+    std::size_t runCount() const { return spilledRuns; }
+    std::size_t mergePassCount() const { return mergePasses; }
+    std::size_t mergedRecordCount() const { return mergedRecords; }
+
+    // Sort the in-memory tail and prepare the k-way merge
+    void finish() {
+        radixSort(buffer, scratch);
+        scratch = {};
+
+        // The final merge reads the runs left on every level; each gets an
+        // equal share of the budget as its read buffer
+        std::size_t runCount = 0;
+        for (const auto& level : levels) {
+            runCount += level.size();
+        }
+        std::size_t perRun = std::max<std::size_t>(memoryBudget / (runCount + 1), 256);
+        for (auto& level : levels) {
+            for (std::FILE* run : level) {
+                readers.push_back(std::make_unique<RunReader>(run, perRun));
+            }
+            level.clear();
+        }
+
+        for (std::size_t source = 0; source <= readers.size(); ++source) {
+            pushSource(source);
+        }
+    }
+
+    bool next(LedgerRecord& out) {
+        if (heap.empty()) {
+            return false;
+        }
+        std::size_t source = heap.top().source;
+        heap.pop();
+        if (source < readers.size()) {
+            out = readers[source]->front();
+            readers[source]->pop();
+        } else {
+            out = buffer[bufferPosition++];
+        }
+        pushSource(source);
+        return true;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Merge-join
+// ---------------------------------------------------------------------------
+
+struct Discrepancy {
+    std::uint64_t transactionId;
+    std::int64_t paidCents;      // 0 when no payment matched
+    std::int64_t refundedCents;
+};
+
+struct ReconciliationReport {
+    std::size_t payments = 0;
+    std::size_t refunds = 0;
+    std::size_t matchedRefunds = 0;         // transaction IDs whose refunds are covered
+    std::size_t duplicatePayments = 0;      // transaction IDs charged more than once
+    std::vector<Discrepancy> unmatched;     // refunds with no payment
+    std::vector<Discrepancy> overRefunded;  // refunds exceeding the payment
+};
+
+// All records of one transaction ID from a sorted stream, summed
+struct IdTotal {
+    std::uint64_t transactionId;
+    std::int64_t cents = 0;
+    std::size_t records = 0;
+};
+
+// Reads the next group of equal IDs; `current` is its first record and is
+// left holding the first record of the following group
+IdTotal takeGroup(ExternalSorter& stream, LedgerRecord& current, bool& hasMore) {
+    IdTotal group{current.transactionId};
+    while (hasMore && current.transactionId == group.transactionId) {
+        group.cents += current.amountCents;
+        ++group.records;
+        hasMore = stream.next(current);
+    }
+    if (hasMore && current.transactionId < group.transactionId) {
+        throw std::logic_error("ledger stream is not sorted by transaction ID");
+    }
+    return group;
+}
+
+// Both sorters must already be finished. Several refunds may share one
+// transaction ID (partial refunds), so refunds are summed per ID first.
+// Payment IDs should be unique; a repeated one (a double charge) is summed
+// and counted, and its refunds are checked against the total charged.
+ReconciliationReport mergeJoin(ExternalSorter& payments, ExternalSorter& refunds) {
+    ReconciliationReport report;
+
+    LedgerRecord payment{};
+    LedgerRecord refund{};
+    bool hasPayment = payments.next(payment);
+    bool hasRefund = refunds.next(refund);
+
+    auto takePayment = [&] {
+        IdTotal paid = takeGroup(payments, payment, hasPayment);
+        report.payments += paid.records;
+        report.duplicatePayments += paid.records > 1;
+        return paid;
+    };
+
+    while (hasRefund) {
+        IdTotal refunded = takeGroup(refunds, refund, hasRefund);
+        report.refunds += refunded.records;
+        std::uint64_t id = refunded.transactionId;
+
+        while (hasPayment && payment.transactionId < id) {
+            takePayment();
+        }
+
+        if (!hasPayment || payment.transactionId != id) {
+            report.unmatched.push_back({id, 0, refunded.cents});
+            continue;
+        }
+        IdTotal paid = takePayment();
+        if (refunded.cents > paid.cents) {
+            report.overRefunded.push_back({id, paid.cents, refunded.cents});
+        } else {
+            ++report.matchedRefunds;
+        }
+    }
+
+    // Drain the remaining payments so the counts are complete
+    while (hasPayment) {
+        takePayment();
+    }
+    return report;
+}
+
+// ---------------------------------------------------------------------------
+// Processors that record what they do
+// ---------------------------------------------------------------------------
+
+// Ledger streams, one pair per processor type
+class Ledger {
+private:
+    std::vector<std::unique_ptr<ExternalSorter>> payments;
+    std::vector<std::unique_ptr<ExternalSorter>> refunds;
+
+public:
+    explicit Ledger(std::size_t memoryBudgetPerStream) {
+        for (std::size_t i = 0; i < PROCESSOR_TYPE_COUNT; ++i) {
+            payments.push_back(std::make_unique<ExternalSorter>(memoryBudgetPerStream));
+            refunds.push_back(std::make_unique<ExternalSorter>(memoryBudgetPerStream));
+        }
+    }
+
+    void recordPayment(ProcessorType type, const LedgerRecord& record) {
+        payments[static_cast<std::size_t>(type)]->add(record);
+    }
+
+    void recordRefund(ProcessorType type, const LedgerRecord& record) {
+        refunds[static_cast<std::size_t>(type)]->add(record);
+    }
+
+    std::size_t runCount() const {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < PROCESSOR_TYPE_COUNT; ++i) {
+            total += payments[i]->runCount() + refunds[i]->runCount();
+        }
+        return total;
+    }
+
+    std::size_t mergePassCount() const {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < PROCESSOR_TYPE_COUNT; ++i) {
+            total += payments[i]->mergePassCount() + refunds[i]->mergePassCount();
+        }
+        return total;
+    }
+
+    std::size_t mergedRecordCount() const {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < PROCESSOR_TYPE_COUNT; ++i) {
+            total += payments[i]->mergedRecordCount() + refunds[i]->mergedRecordCount();
+        }
+        return total;
+    }
+
+    ReconciliationReport reconcile(ProcessorType type) {
+        auto index = static_cast<std::size_t>(type);
+        payments[index]->finish();
+        refunds[index]->finish();
+        return mergeJoin(*payments[index], *refunds[index]);
+    }
+};
+
+// Same interface as before, but every call leaves a trace in the ledger
+class PaymentProcessor {
+protected:
+    Ledger& ledger;
+
+public:
+    explicit PaymentProcessor(Ledger& ledger) : ledger(ledger) {}
+    virtual ~PaymentProcessor() = default;
+
+    virtual bool process(std::uint64_t transactionId, std::int64_t amountCents) = 0;
+    virtual void refund(std::uint64_t transactionId, std::int64_t amountCents) = 0;
+    virtual ProcessorType getType() const = 0;
+    virtual const char* getProcessorName() const = 0;
+};
+
+// The three processors differ only in identity, so a template keeps them short
+template <ProcessorType Type>
+class RecordingProcessor : public PaymentProcessor {
+public:
+    using PaymentProcessor::PaymentProcessor;
+
+    bool process(std::uint64_t transactionId, std::int64_t amountCents) override {
+        ledger.recordPayment(Type, {transactionId, amountCents});
+        return true;
+    }
+
+    void refund(std::uint64_t transactionId, std::int64_t amountCents) override {
+        ledger.recordRefund(Type, {transactionId, amountCents});
+    }
+
+    ProcessorType getType() const override { return Type; }
+    const char* getProcessorName() const override { return toString(Type); }
+};
+
+using CreditCardProcessor = RecordingProcessor<ProcessorType::CreditCard>;
+using PayPalProcessor = RecordingProcessor<ProcessorType::PayPal>;
+using ApplePayProcessor = RecordingProcessor<ProcessorType::ApplePay>;
+
+// ---------------------------------------------------------------------------
+// Demo and benchmark
+// ---------------------------------------------------------------------------
+
+// Scrambles sequential numbers into unique, unordered transaction IDs
+std::uint64_t scramble(std::uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+void printReport(ProcessorType type, const ReconciliationReport& report) {
+    std::cout << toString(type) << ": "
+              << report.payments << " payments, "
+              << report.refunds << " refunds, "
+              << report.matchedRefunds << " matched, "
+              << report.unmatched.size() << " unmatched, "
+              << report.overRefunded.size() << " over-refunded, "
+              << report.duplicatePayments << " charged twice\n";
+
+    for (std::size_t i = 0; i < std::min<std::size_t>(report.overRefunded.size(), 2); ++i) {
+        const auto& d = report.overRefunded[i];
+        std::cout << "  over-refund tx " << d.transactionId << ": paid "
+                  << d.paidCents << "c, refunded " << d.refundedCents << "c\n";
+    }
+    for (std::size_t i = 0; i < std::min<std::size_t>(report.unmatched.size(), 2); ++i) {
+        const auto& d = report.unmatched[i];
+        std::cout << "  unmatched refund tx " << d.transactionId << ": "
+                  << d.refundedCents << "c\n";
+    }
+}
+
+int run(int argc, char* argv[]) {
+    // Usage: polymorphism_04_reconciliation [payments] [records-in-memory-per-stream]
+    // e.g. 100000000 1000000 reconciles 100M payments using ~16 MB per stream.
+    std::size_t paymentCount = argc > 1 ? std::stoull(argv[1]) : 2'000'000;
+    std::size_t memoryBudget = argc > 2 ? std::stoull(argv[2]) : 250'000;
+
+    Ledger ledger(memoryBudget);
+
+    std::vector<std::unique_ptr<PaymentProcessor>> processors;
+    processors.push_back(std::make_unique<CreditCardProcessor>(ledger));
+    processors.push_back(std::make_unique<PayPalProcessor>(ledger));
+    processors.push_back(std::make_unique<ApplePayProcessor>(ledger));
+
+    std::cout << "=== Recording " << paymentCount << " payments ===\n";
+    auto start = std::chrono::steady_clock::now();
+
+    // What the reconciliation must find, tallied while the data is generated
+    ReconciliationReport expected[PROCESSOR_TYPE_COUNT];
+
+    std::size_t refundCount = 0;
+    for (std::uint64_t i = 0; i < paymentCount; ++i) {
+        PaymentProcessor& processor = *processors[i % processors.size()];
+        ReconciliationReport& expect = expected[static_cast<std::size_t>(processor.getType())];
+        std::uint64_t id = scramble(i);
+        std::int64_t cents = 100 + static_cast<std::int64_t>(i % 50'000);
+        std::int64_t paid = cents;
+        std::int64_t refunded = 0;
+        std::size_t refunds = 0;
+        processor.process(id, cents);
+        ++expect.payments;
+
+        if (i % 10 == 0) {          // full refund
+            processor.refund(id, cents);
+            refunded += cents;
+            refunds += 1;
+        } else if (i % 10 == 1) {   // two partial refunds
+            processor.refund(id, cents / 2);
+            processor.refund(id, cents / 4);
+            refunded += cents / 2 + cents / 4;
+            refunds += 2;
+        }
+        if (i % 100'003 == 7) {     // two more full refunds
+            processor.refund(id, cents);
+            processor.refund(id, cents);
+            refunded += 2 * cents;
+            refunds += 2;
+        }
+        if (i % 300'007 == 5) {     // charged twice by mistake
+            processor.process(id, cents);
+            paid += cents;
+            ++expect.payments;
+            ++expect.duplicatePayments;
+        }
+        if (i % 250'007 == 3) {     // refund for a payment that never happened
+            processor.refund(scramble(i + paymentCount), cents);
+            expect.unmatched.push_back({scramble(i + paymentCount), 0, cents});
+            ++expect.refunds;
+            ++refundCount;
+        }
+
+        expect.refunds += refunds;
+        refundCount += refunds;
+        if (refunded > paid) {
+            expect.overRefunded.push_back({id, paid, refunded});
+        } else if (refunds > 0) {
+            ++expect.matchedRefunds;
+        }
+    }
+
+    auto recorded = std::chrono::steady_clock::now();
+
+    std::cout << "\n=== Reconciliation ===\n";
+    bool allFound = true;
+    for (const auto& processor : processors) {
+        ReconciliationReport report = ledger.reconcile(processor->getType());
+        printReport(processor->getType(), report);
+        const ReconciliationReport& expect = expected[static_cast<std::size_t>(processor->getType())];
+        allFound = allFound && report.payments == expect.payments &&
+                   report.refunds == expect.refunds &&
+                   report.matchedRefunds == expect.matchedRefunds &&
+                   report.duplicatePayments == expect.duplicatePayments &&
+                   report.unmatched.size() == expect.unmatched.size() &&
+                   report.overRefunded.size() == expect.overRefunded.size();
+    }
+    std::cout << (allFound ? "PASS" : "FAIL") << ": every injected discrepancy found, nothing else\n";
+
+    auto finished = std::chrono::steady_clock::now();
+
+    double recordSeconds = std::chrono::duration<double>(recorded - start).count();
+    double reconcileSeconds = std::chrono::duration<double>(finished - recorded).count();
+    double totalRecords = static_cast<double>(paymentCount + refundCount);
+
+    std::cout << "\n=== Benchmark ===\n";
+    std::cout << "Records:        " << paymentCount + refundCount << "\n";
+    std::cout << "Sorted runs:    " << ledger.runCount() << " spilled to disk, "
+              << ledger.mergePassCount() << " intermediate merges\n";
+    std::cout << "Merge rewrites: " << ledger.mergedRecordCount() << " records ("
+              << static_cast<double>(ledger.mergedRecordCount()) / totalRecords << " per record)\n";
+    std::cout << "Record + spill: " << recordSeconds << " s\n";
+    std::cout << "Merge + join:   " << reconcileSeconds << " s\n";
+    std::cout << "Throughput:     "
+              << static_cast<std::size_t>(totalRecords / (recordSeconds + reconcileSeconds))
+              << " records/s\n";
+
+    return allFound ? 0 : 1;
+}
+
+int main(int argc, char* argv[]) {
+    // Temporary files can run out (disk full, no writable temp directory)
+    try {
+        return run(argc, argv);
+    } catch (const std::exception& error) {
+        std::cerr << "Error: " << error.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,306 @@
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../01-abstraction/calculator.h"
+#include "../01-abstraction/car.h"
+#include "../01-abstraction/shapes.h"
+#include "../02-encapsulation/animal.h"
+#include "../02-encapsulation/bank_account.h"
+#include "../03-inheritance/employees.h"
+#include "../03-inheritance/vehicles.h"
+#include "../03-inheritance/virtual_functions.h"
+#include "animals.h"
+#include "payment_processors.h"
+#include "vtable_shapes.h"
+
+// Example: Inspecting object layout - vptr, member offsets, padding
+//
+// 03_vtable_explanation.cpp only prints sizeof. This example shows where
+// every byte of the example classes goes. The classes come from the same
+// headers the examples include; each one lists its members right where
+// it declares them, with LAYOUT_FIELDS (common/layout_fields.h), and the
+// report (offsets, padding, cache line straddling) is generated from
+// those lists.
+//
+// Three checks keep the lists honest, and a failed one fails the run:
+// - every gap between listed members must be exactly the padding their
+//   alignment requires, so a forgotten int or pointer shows up;
+// - the object is copied into buffers filled with known byte patterns,
+//   and a byte the copy writes outside every listed member is a member
+//   someone forgot - even a bool hiding in padding;
+// - the size guards at the end fail the build when a class changes size.
+// The copy check needs a class it can copy on its own: abstract bases are
+// covered by their derived classes, and trivially copyable types are
+// skipped because copying them may copy the padding as well.
+
+constexpr std::size_t CACHE_LINE = 64;
+
+struct FieldInfo {
+    std::string name;
+    std::size_t offset;
+    std::size_t size;
+    std::size_t alignment;
+};
+
+class LayoutReport {
+private:
+    std::string typeName;
+    std::size_t size;
+    std::size_t alignment;
+    bool polymorphic;
+    std::vector<FieldInfo> fields;
+    std::vector<bool> written;  // empty when the copy check was skipped
+
+public:
+    LayoutReport(std::string typeName, std::size_t size, std::size_t alignment, bool polymorphic)
+        : typeName(std::move(typeName)), size(size), alignment(alignment), polymorphic(polymorphic) {}
+
+    // Offset is measured on a live object, so it also works for
+    // classes that are not standard-layout (offsetof would not)
+    template <typename Member>
+    void field(const void* object, const char* owner, const char* name, const Member& member) {
+        const auto* base = static_cast<const char*>(object);
+        const auto* address = reinterpret_cast<const char*>(&member);
+        fields.push_back({std::string(owner) + "::" + name,
+                          static_cast<std::size_t>(address - base), sizeof(Member), alignof(Member)});
+    }
+
+    void setWrittenBytes(std::vector<bool> bytes) { written = std::move(bytes); }
+
+    std::size_t paddingBytes() const {
+        std::size_t used = polymorphic ? sizeof(void*) : 0;
+        for (const auto& f : fields) {
+            used += f.size;
+        }
+        return size - used;
+    }
+
+    // Prints the report; returns false if the member list looks incomplete
+    bool print() const {
+        std::vector<FieldInfo> rows = fields;
+        if (polymorphic) {
+            // Not measurable from C++: the vptr is where the ABI puts it
+            rows.push_back({"<vptr, at offset 0 by ABI>", 0, sizeof(void*), alignof(void*)});
+        }
+        std::sort(rows.begin(), rows.end(),
+                  [](const FieldInfo& a, const FieldInfo& b) { return a.offset < b.offset; });
+
+        std::cout << "\n" << typeName << "  (sizeof " << size << ", alignof " << alignment
+                  << ", padding " << paddingBytes() << ")\n";
+
+        bool complete = true;
+        std::size_t cursor = 0;
+        // A gap is padding only if the next member's alignment (or the
+        // whole object's, at the end) explains every byte of it, and the
+        // copy wrote none of it
+        auto printGap = [&](std::size_t until, std::size_t nextAlignment) {
+            if (until <= cursor) {
+                return;
+            }
+            bool padding = (cursor + nextAlignment - 1) / nextAlignment * nextAlignment == until;
+            for (std::size_t i = cursor; i < until && i < written.size(); ++i) {
+                padding = padding && !written[i];
+            }
+            complete = complete && padding;
+            std::cout << "  " << std::setw(4) << cursor << "  " << std::setw(4)
+                      << until - cursor << (padding ? "  <padding>\n" : "  <unlisted member>\n");
+        };
+
+        for (const auto& row : rows) {
+            if (row.offset < cursor) {
+                // Overlaps the previous row - e.g. a member where the vptr should be
+                complete = false;
+                std::cout << "  overlapping rows: the ABI assumption does not hold here\n";
+            }
+            printGap(row.offset, row.alignment);
+            std::cout << "  " << std::setw(4) << row.offset << "  " << std::setw(4)
+                      << row.size << "  " << row.name;
+            // Assumes the object starts on a cache line boundary
+            if (row.offset / CACHE_LINE != (row.offset + row.size - 1) / CACHE_LINE) {
+                std::cout << "  [straddles cache line]";
+            }
+            std::cout << "\n";
+            cursor = std::max(cursor, row.offset + row.size);
+        }
+        printGap(size, alignment);
+        return complete;
+    }
+};
+
+// Called by the layoutFields() a class defines with LAYOUT_FIELDS, once
+// per member; base class members arrive first
+struct FieldCollector {
+    LayoutReport& report;
+    const void* object;  // offsets are from the start of the whole object
+
+    template <typename Member>
+    void operator()(const char* owner, const char* name, const Member& member) {
+        report.field(object, owner, name, member);
+    }
+};
+
+template <typename T, typename = void>
+struct HasLayoutFields : std::false_type {};
+
+template <typename T>
+struct HasLayoutFields<T, std::void_t<decltype(layoutFields(std::declval<const T&>(),
+                                                            std::declval<FieldCollector&>()))>>
+    : std::true_type {};
+
+// Which bytes of a T its copy constructor writes. The copy is built twice,
+// over all-zero and all-one bytes; a byte that differs from what was
+// there before in either copy was written.
+template <typename T>
+std::vector<bool> writtenBytes(const T& sample) {
+    std::vector<bool> written(sizeof(T), false);
+    for (unsigned char fill : {0x00, 0xFF}) {
+        alignas(T) unsigned char storage[sizeof(T)];
+        // volatile, or the compiler may drop the fill as a dead store:
+        // the constructor is allowed to assume the old bytes are garbage
+        volatile unsigned char* bytes = storage;
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            bytes[i] = fill;
+        }
+        T* copy = new (storage) T(sample);
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            written[i] = written[i] || bytes[i] != fill;
+        }
+        copy->~T();
+    }
+    return written;
+}
+
+// T may be an abstract base: pass any derived object as the sample and
+// name T explicitly, e.g. inspect<Shape>("Shape", circle)
+template <typename T>
+LayoutReport inspect(const char* name, const T& sample) {
+    LayoutReport report(name, sizeof(T), alignof(T), std::is_polymorphic_v<T>);
+    if constexpr (HasLayoutFields<T>::value) {
+        FieldCollector collector{report, &sample};
+        layoutFields(sample, collector);
+    }
+    if constexpr (!std::is_abstract_v<T> && std::is_copy_constructible_v<T> &&
+                  !std::is_trivially_copyable_v<T>) {
+        report.setWrittenBytes(writtenBytes(sample));
+    }
+    return report;
+}
+
+// ---------------------------------------------------------------------------
+// Size guards - a layout change makes the build fail here
+// ---------------------------------------------------------------------------
+
+// The expected sizes hold for 64-bit libstdc++ (GCC, and Clang on Linux).
+// Other standard libraries have a different std::string, so skip there.
+#if defined(__GLIBCXX__) && defined(__LP64__)
+#define LAYOUT_EXPECT_SIZE(Type, bytes) \
+    static_assert(sizeof(Type) == (bytes), "Layout of " #Type " changed - update the expected size")
+#else
+#define LAYOUT_EXPECT_SIZE(Type, bytes) static_assert(true, "")
+#endif
+
+LAYOUT_EXPECT_SIZE(abstraction::Calculator, 4);
+LAYOUT_EXPECT_SIZE(abstraction::Car, 80);
+LAYOUT_EXPECT_SIZE(abstraction::Shape, 40);
+LAYOUT_EXPECT_SIZE(abstraction::Circle, 48);
+LAYOUT_EXPECT_SIZE(abstraction::Rectangle, 56);
+LAYOUT_EXPECT_SIZE(abstraction::Triangle, 64);
+LAYOUT_EXPECT_SIZE(encapsulation::Money, 8);
+LAYOUT_EXPECT_SIZE(encapsulation::BankAccount::Transaction, 16);
+LAYOUT_EXPECT_SIZE(encapsulation::BankAccount, 96);
+LAYOUT_EXPECT_SIZE(encapsulation::Animal, 24);
+LAYOUT_EXPECT_SIZE(encapsulation::Dog, 24);
+LAYOUT_EXPECT_SIZE(inheritance::Vehicle, 48);
+LAYOUT_EXPECT_SIZE(inheritance::Car, 48);
+LAYOUT_EXPECT_SIZE(inheritance::Motorcycle, 48);
+LAYOUT_EXPECT_SIZE(inheritance::BaseClass, 8);
+LAYOUT_EXPECT_SIZE(inheritance::DerivedClass, 8);
+LAYOUT_EXPECT_SIZE(inheritance::FurtherDerived, 8);
+LAYOUT_EXPECT_SIZE(inheritance::Employee, 40);
+LAYOUT_EXPECT_SIZE(inheritance::Engineer, 48);
+LAYOUT_EXPECT_SIZE(inheritance::Manager, 48);
+LAYOUT_EXPECT_SIZE(inheritance::Designer, 48);
+LAYOUT_EXPECT_SIZE(polymorphism::Animal, 8);
+LAYOUT_EXPECT_SIZE(polymorphism::Dog, 16);
+LAYOUT_EXPECT_SIZE(polymorphism::Cat, 16);
+LAYOUT_EXPECT_SIZE(polymorphism::Bird, 16);
+LAYOUT_EXPECT_SIZE(polymorphism::PaymentProcessor, 8);
+LAYOUT_EXPECT_SIZE(polymorphism::CreditCardProcessor, 8);
+LAYOUT_EXPECT_SIZE(polymorphism::PayPalProcessor, 8);
+LAYOUT_EXPECT_SIZE(polymorphism::ApplePayProcessor, 8);
+LAYOUT_EXPECT_SIZE(polymorphism::Shape, 8);
+LAYOUT_EXPECT_SIZE(polymorphism::Circle, 8);
+LAYOUT_EXPECT_SIZE(polymorphism::Square, 8);
+LAYOUT_EXPECT_SIZE(polymorphism::Triangle, 8);
+
+int main() {
+    std::cout << "=== Object Layouts ===\n";
+    std::cout << "Columns: offset, size, member (cache line = " << CACHE_LINE << " bytes)\n";
+    std::cout << "The vptr cannot be located from C++; it is shown at offset 0, where the\n"
+              << "Itanium and MSVC ABIs put it for single inheritance.\n";
+
+    const abstraction::Circle circle("My Circle", 5.0);
+    const inheritance::DerivedClass derived;
+    const inheritance::Engineer engineer("Alice");
+    const polymorphism::Dog dog("Husky");
+    const polymorphism::CreditCardProcessor creditCard;
+    const polymorphism::Circle vtableCircle;
+
+    std::vector<LayoutReport> reports;
+    reports.push_back(inspect("abstraction::Calculator", abstraction::Calculator()));
+    reports.push_back(inspect("abstraction::Car", abstraction::Car("Toyota", "Corolla", 2023)));
+    reports.push_back(inspect<abstraction::Shape>("abstraction::Shape", circle));
+    reports.push_back(inspect("abstraction::Circle", circle));
+    reports.push_back(inspect("abstraction::Rectangle", abstraction::Rectangle("My Rectangle", 4, 6)));
+    reports.push_back(inspect("abstraction::Triangle", abstraction::Triangle("My Triangle", 3, 4, 5)));
+    reports.push_back(inspect("encapsulation::Money", encapsulation::Money::fromCents(100000)));
+    reports.push_back(inspect("encapsulation::BankAccount::Transaction",
+                              encapsulation::BankAccount::Transaction{
+                                  encapsulation::BankAccount::TransactionType::Deposit,
+                                  encapsulation::Money::fromCents(50000)}));
+    reports.push_back(inspect("encapsulation::BankAccount",
+                              encapsulation::BankAccount("ACC-12345", "Alice Smith",
+                                                         encapsulation::Money::fromCents(100000))));
+    reports.push_back(inspect("encapsulation::Animal", encapsulation::Animal()));
+    reports.push_back(inspect("encapsulation::Dog", encapsulation::Dog()));
+    reports.push_back(inspect("inheritance::Vehicle", inheritance::Vehicle("Toyota", 2023)));
+    reports.push_back(inspect("inheritance::Car", inheritance::Car("Toyota", 2023, 4)));
+    reports.push_back(inspect("inheritance::Motorcycle",
+                              inheritance::Motorcycle("Harley-Davidson", 2022, false)));
+    reports.push_back(inspect<inheritance::BaseClass>("inheritance::BaseClass", derived));
+    reports.push_back(inspect("inheritance::DerivedClass", derived));
+    reports.push_back(inspect("inheritance::FurtherDerived", inheritance::FurtherDerived()));
+    reports.push_back(inspect<inheritance::Employee>("inheritance::Employee", engineer));
+    reports.push_back(inspect("inheritance::Engineer", engineer));
+    reports.push_back(inspect("inheritance::Manager", inheritance::Manager("Bob")));
+    reports.push_back(inspect("inheritance::Designer", inheritance::Designer("Charlie")));
+    reports.push_back(inspect<polymorphism::Animal>("polymorphism::Animal", dog));
+    reports.push_back(inspect("polymorphism::Dog", dog));
+    reports.push_back(inspect("polymorphism::Cat", polymorphism::Cat("Orange")));
+    reports.push_back(inspect("polymorphism::Bird", polymorphism::Bird("Parrot")));
+    reports.push_back(inspect<polymorphism::PaymentProcessor>("polymorphism::PaymentProcessor", creditCard));
+    reports.push_back(inspect("polymorphism::CreditCardProcessor", creditCard));
+    reports.push_back(inspect("polymorphism::PayPalProcessor", polymorphism::PayPalProcessor()));
+    reports.push_back(inspect("polymorphism::ApplePayProcessor", polymorphism::ApplePayProcessor()));
+    reports.push_back(inspect<polymorphism::Shape>("polymorphism::Shape", vtableCircle));
+    reports.push_back(inspect("polymorphism::Circle", vtableCircle));
+    reports.push_back(inspect("polymorphism::Square", polymorphism::Square()));
+    reports.push_back(inspect("polymorphism::Triangle", polymorphism::Triangle()));
+
+    std::size_t incomplete = 0;
+    for (const auto& report : reports) {
+        incomplete += !report.print();
+    }
+    if (incomplete > 0) {
+        std::cout << "\nFAIL: " << incomplete << " layout(s) have unlisted members or overlaps\n";
+        return 1;
+    }
+    return 0;
+}
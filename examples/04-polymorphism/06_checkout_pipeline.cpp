@@ -0,0 +1,338 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "payment_processors.h"
+
+using polymorphism::PaymentProcessor;
+
+// Example: Checkout as a pipeline of threads
+//
+// checkoutOrder() (payment_processors.h) charges each order and prints its
+// receipt, one order after another on a single thread. Here the same steps
+// become stages, each on its own thread:
+//
+//   take order -> process payment -> format receipt -> output
+//
+// Neighbouring stages are linked by bounded single-producer/single-consumer
+// ring buffers. A full ring makes the upstream stage wait (backpressure),
+// so a slow stage cannot make memory use grow without limit.
+//
+// The serial baseline is the real checkoutOrder() with std::cout captured;
+// the pipeline must produce exactly the same text, byte for byte.
+//
+// Note: a pipeline only pays off with a core per stage. On a machine with
+// fewer cores the threads take turns and the serial version can win.
+
+// Keeps the two indices on separate cache lines so producer and consumer
+// do not invalidate each other's line on every operation
+constexpr std::size_t CACHE_LINE = 64;
+
+template <typename T, std::size_t Capacity>
+class SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+private:
+    alignas(CACHE_LINE) std::atomic<std::size_t> head{0};  // next slot to read
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail{0};  // next slot to write
+    alignas(CACHE_LINE) T slots[Capacity];
+
+public:
+    bool tryPush(const T& value) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == Capacity) {
+            return false;  // full
+        }
+        slots[t & (Capacity - 1)] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(T& value) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;  // empty
+        }
+        value = std::move(slots[h & (Capacity - 1)]);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Blocking versions: spin briefly, then give the core away
+    void push(const T& value) {
+        while (!tryPush(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    void pop(T& value) {
+        while (!tryPop(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Approximate when called from a third thread; exact enough for stats
+    std::size_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Capturing std::cout
+// ---------------------------------------------------------------------------
+
+// Collects everything written to it in a string
+class CaptureBuffer : public std::streambuf {
+private:
+    std::string text;
+
+protected:
+    int overflow(int c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            text.push_back(traits_type::to_char_type(c));
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize count) override {
+        text.append(data, static_cast<std::size_t>(count));
+        return count;
+    }
+
+public:
+    const std::string& getText() const { return text; }
+
+    // Hands over what was written so far and starts again from empty
+    std::string take() { return std::exchange(text, std::string()); }
+};
+
+// Points std::cout at a buffer for as long as it lives. std::cout is shared
+// by every thread, so only one thread may write to it meanwhile.
+class RedirectedOutput {
+private:
+    std::streambuf* original;
+
+public:
+    explicit RedirectedOutput(std::streambuf& buffer) : original(std::cout.rdbuf(&buffer)) {}
+    ~RedirectedOutput() { std::cout.rdbuf(original); }
+
+    RedirectedOutput(const RedirectedOutput&) = delete;
+    RedirectedOutput& operator=(const RedirectedOutput&) = delete;
+};
+
+// ---------------------------------------------------------------------------
+// Work items passed between stages
+// ---------------------------------------------------------------------------
+
+struct Order {
+    double cartTotal = 0.0;
+    PaymentProcessor* processor = nullptr;
+    bool approved = false;
+    std::string gatewayLog;    // what process() printed
+    bool endOfStream = false;  // sent once after the last order
+};
+
+struct Receipt {
+    std::string text;
+    bool endOfStream = false;
+};
+
+Order makeOrder(std::uint64_t id, const std::vector<std::unique_ptr<PaymentProcessor>>& processors) {
+    Order order;
+    order.cartTotal = 5.0 + static_cast<double>(id % 20'000) / 4.0;
+    order.processor = processors[id % processors.size()].get();
+    return order;
+}
+
+// The processors print while they work; the charge stage is the only one
+// writing to std::cout, so it captures that text and passes it on
+void charge(Order& order, CaptureBuffer& gatewayOutput) {
+    order.approved = order.processor->process(order.cartTotal);
+    order.gatewayLog = gatewayOutput.take();
+}
+
+// The text checkoutOrder() prints around the gateway's own output
+void formatReceipt(const Order& order, Receipt& receipt) {
+    char total[32];
+    std::snprintf(total, sizeof(total), "%.2f", order.cartTotal);
+    receipt.text.clear();
+    receipt.text += "\n=== Checkout Order ===\nUsing: ";
+    receipt.text += order.processor->getProcessorName();
+    receipt.text += "\nTotal: $";
+    receipt.text += total;
+    receipt.text += "\n\nProcessing payment...\n";
+    receipt.text += order.gatewayLog;
+    receipt.text += order.approved ? "\u2713 Order completed successfully!\n" : "\u2717 Payment failed\n";
+}
+
+// Checks each receipt against the serial checkout's output as it arrives
+struct OutputSink {
+    const std::string& expected;
+    std::size_t offset = 0;
+    std::size_t receipts = 0;
+    std::size_t firstMismatch = SIZE_MAX;  // receipt number
+
+    void write(const Receipt& receipt) {
+        if (firstMismatch == SIZE_MAX &&
+            expected.compare(offset, receipt.text.size(), receipt.text) != 0) {
+            firstMismatch = receipts;
+        }
+        offset += receipt.text.size();
+        ++receipts;
+    }
+
+    bool matches() const { return firstMismatch == SIZE_MAX && offset == expected.size(); }
+};
+
+// ---------------------------------------------------------------------------
+// Serial and pipelined checkout
+// ---------------------------------------------------------------------------
+
+// The real checkoutOrder(), with its output collected instead of printed
+std::string serialCheckout(std::size_t count,
+                           const std::vector<std::unique_ptr<PaymentProcessor>>& processors) {
+    CaptureBuffer output;
+    RedirectedOutput redirect(output);
+    for (std::uint64_t id = 0; id < count; ++id) {
+        Order order = makeOrder(id, processors);
+        polymorphism::checkoutOrder(*order.processor, order.cartTotal);
+    }
+    return output.take();
+}
+
+struct QueueStats {
+    std::size_t samples = 0;
+    std::size_t total = 0;
+    std::size_t max = 0;
+
+    void record(std::size_t depth) {
+        ++samples;
+        total += depth;
+        max = std::max(max, depth);
+    }
+    double average() const { return samples ? static_cast<double>(total) / samples : 0.0; }
+};
+
+constexpr std::size_t RING_CAPACITY = 1024;
+
+void pipelinedCheckout(std::size_t count, const std::vector<std::unique_ptr<PaymentProcessor>>& processors,
+                       OutputSink& sink, QueueStats stats[3]) {
+    // Rings are large, so they live on the heap rather than the stack
+    auto toCharge = std::make_unique<SpscRing<Order, RING_CAPACITY>>();
+    auto toFormat = std::make_unique<SpscRing<Order, RING_CAPACITY>>();
+    auto toOutput = std::make_unique<SpscRing<Receipt, RING_CAPACITY>>();
+
+    // Each consumer records the depth of its input ring when it takes an item
+    std::thread source([&] {
+        for (std::uint64_t id = 0; id < count; ++id) {
+            toCharge->push(makeOrder(id, processors));
+        }
+        Order end;
+        end.endOfStream = true;
+        toCharge->push(end);
+    });
+
+    std::thread charger([&] {
+        CaptureBuffer gatewayOutput;
+        RedirectedOutput redirect(gatewayOutput);
+        Order order;
+        while (true) {
+            toCharge->pop(order);
+            stats[0].record(toCharge->size());
+            if (!order.endOfStream) {
+                charge(order, gatewayOutput);
+            }
+            toFormat->push(order);
+            if (order.endOfStream) {
+                return;
+            }
+        }
+    });
+
+    std::thread formatter([&] {
+        Order order;
+        Receipt receipt;
+        while (true) {
+            toFormat->pop(order);
+            stats[1].record(toFormat->size());
+            receipt.endOfStream = order.endOfStream;
+            if (!order.endOfStream) {
+                formatReceipt(order, receipt);
+            }
+            toOutput->push(receipt);
+            if (order.endOfStream) {
+                return;
+            }
+        }
+    });
+
+    // Output runs on the calling thread
+    Receipt receipt;
+    while (true) {
+        toOutput->pop(receipt);
+        stats[2].record(toOutput->size());
+        if (receipt.endOfStream) {
+            break;
+        }
+        sink.write(receipt);
+    }
+
+    source.join();
+    charger.join();
+    formatter.join();
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::unique_ptr<PaymentProcessor>> processors;
+    processors.push_back(std::make_unique<polymorphism::CreditCardProcessor>());
+    processors.push_back(std::make_unique<polymorphism::PayPalProcessor>());
+    processors.push_back(std::make_unique<polymorphism::ApplePayProcessor>());
+
+    // Usage: polymorphism_06_pipeline [orders]
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100'000;
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+
+    // Nothing else may print while std::cout is redirected, so the
+    // sections below report once both runs are done
+    auto start = std::chrono::steady_clock::now();
+    std::string serialOutput = serialCheckout(count, processors);
+    double serialSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    OutputSink pipelineSink{serialOutput};
+    QueueStats stats[3];
+    start = std::chrono::steady_clock::now();
+    pipelinedCheckout(count, processors, pipelineSink, stats);
+    double pipelineSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "\n=== First receipt (both versions) ===";
+    std::size_t firstEnd = serialOutput.find("\n=== Checkout Order ===", 1);
+    std::cout << serialOutput.substr(0, firstEnd) << "\n";
+
+    std::cout << "\n=== Results (" << count << " orders) ===\n";
+    std::cout << "Serial:    " << static_cast<long long>(count / serialSeconds) << " orders/s\n";
+    std::cout << "Pipelined: " << static_cast<long long>(count / pipelineSeconds) << " orders/s\n";
+    bool same = pipelineSink.matches() && pipelineSink.receipts == count;
+    std::cout << "Same output: " << std::boolalpha << same << " (" << serialOutput.size()
+              << " bytes compared)\n";
+    if (!same && pipelineSink.firstMismatch != SIZE_MAX) {
+        std::cout << "First difference in receipt " << pipelineSink.firstMismatch << "\n";
+    }
+
+    const char* names[3] = { "orders -> charge", "charge -> format", "format -> output" };
+    std::cout << "\nQueue depth (capacity " << RING_CAPACITY << "):\n";
+    for (int i = 0; i < 3; ++i) {
+        std::cout << "  " << names[i] << ": avg " << stats[i].average()
+                  << ", max " << stats[i].max << "\n";
+    }
+
+    return same ? 0 : 1;
+}
@@ -0,0 +1,301 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Example: The animal simulation as an entity-component-system (ECS)
+//
+// In 01_animal_example.cpp each animal is an object and each behaviour is a
+// virtual call. That reads well, but updating a million animals means a
+// million pointer chases to scattered heap objects and a million indirect
+// calls per tick.
+//
+// An ECS turns this inside out:
+//   - an entity is just an index
+//   - components are plain data, one packed array per field
+//   - systems are loops that update one component array for all entities
+//
+// The difference between a Dog, a Cat and a Bird is no longer an override
+// but a row of numbers (speed, cruising altitude, sound, description). The
+// movement system then runs the same branch-free loop over every entity,
+// which the compiler can vectorize.
+
+enum class Kind : std::uint8_t { Dog, Cat, Bird };
+
+// Per-kind behaviour, expressed as data instead of overrides
+struct LocomotionProfile {
+    float speed;            // how fast the animal covers ground
+    float cruiseAltitude;   // 0 for animals that stay on the ground
+    const char* sound;
+    const char* movement;
+};
+
+const LocomotionProfile PROFILES[] = {
+    /* Dog  */ { 4.0f,  0.0f, "Woof! Woof!",  "Running on four legs" },
+    /* Cat  */ { 2.0f,  0.0f, "Meow! Meow!",  "Walking silently on four legs" },
+    /* Bird */ { 6.0f, 30.0f, "Tweet! Tweet!", "Flying in the sky" },
+};
+
+constexpr float CLIMB_RATE = 0.5f;  // fraction of the altitude gap closed per second
+
+// ---------------------------------------------------------------------------
+// The classic virtual hierarchy, extended with a position so there is
+// something to update
+// ---------------------------------------------------------------------------
+
+namespace oop {
+
+class Animal {
+protected:
+    float x = 0.0f, y = 0.0f;  // y follows the cruise altitude, so only x has a direction
+    float dirX = 1.0f;
+
+public:
+    Animal(float x, float dirX) : x(x), dirX(dirX) {}
+    virtual ~Animal() = default;
+
+    virtual void move(float dt) = 0;
+    virtual void makeSound() const = 0;
+    virtual void describe() const = 0;
+
+    float getX() const { return x; }
+    float getY() const { return y; }
+};
+
+class Dog : public Animal {
+private:
+    std::string breed;
+
+public:
+    Dog(std::string breed, float x, float dirX)
+        : Animal(x, dirX), breed(std::move(breed)) {}
+
+    void move(float dt) override {
+        x += dirX * PROFILES[0].speed * dt;
+        y += (PROFILES[0].cruiseAltitude - y) * CLIMB_RATE * dt;
+    }
+    void makeSound() const override { std::cout << PROFILES[0].sound << "\n"; }
+    void describe() const override { std::cout << "I am a " << breed << " dog\n"; }
+};
+
+class Cat : public Animal {
+private:
+    std::string color;
+
+public:
+    Cat(std::string color, float x, float dirX)
+        : Animal(x, dirX), color(std::move(color)) {}
+
+    void move(float dt) override {
+        x += dirX * PROFILES[1].speed * dt;
+        y += (PROFILES[1].cruiseAltitude - y) * CLIMB_RATE * dt;
+    }
+    void makeSound() const override { std::cout << PROFILES[1].sound << "\n"; }
+    void describe() const override { std::cout << "I am a " << color << " cat\n"; }
+};
+
+class Bird : public Animal {
+private:
+    std::string species;
+
+public:
+    Bird(std::string species, float x, float dirX)
+        : Animal(x, dirX), species(std::move(species)) {}
+
+    void move(float dt) override {
+        x += dirX * PROFILES[2].speed * dt;
+        y += (PROFILES[2].cruiseAltitude - y) * CLIMB_RATE * dt;
+    }
+    void makeSound() const override { std::cout << PROFILES[2].sound << "\n"; }
+    void describe() const override { std::cout << "I am a " << species << "\n"; }
+};
+
+}  // namespace oop
+
+// ---------------------------------------------------------------------------
+// The ECS version
+// ---------------------------------------------------------------------------
+
+namespace ecs {
+
+using Entity = std::uint32_t;
+
+// Structure of arrays: entity i's data sits at index i of every array
+struct World {
+    // Transform components
+    std::vector<float> x, y;
+    std::vector<float> dirX;
+    // Locomotion components, copied from the kind's profile at spawn time
+    std::vector<float> speed;
+    std::vector<float> cruiseAltitude;
+    // Identity components - only needed for sound and description
+    std::vector<Kind> kind;
+    std::vector<std::uint16_t> label;  // index into `labels`
+    std::vector<std::string> labels;   // "Golden Retriever", "Orange", ...
+
+    std::size_t size() const { return x.size(); }
+
+    void reserve(std::size_t count) {
+        for (auto* array : { &x, &y, &dirX, &speed, &cruiseAltitude }) {
+            array->reserve(count);
+        }
+        kind.reserve(count);
+        label.reserve(count);
+    }
+
+    std::uint16_t internLabel(const std::string& text) {
+        for (std::size_t i = 0; i < labels.size(); ++i) {
+            if (labels[i] == text) {
+                return static_cast<std::uint16_t>(i);
+            }
+        }
+        labels.push_back(text);
+        return static_cast<std::uint16_t>(labels.size() - 1);
+    }
+
+    Entity spawn(Kind animalKind, const std::string& description, float startX, float directionX) {
+        const LocomotionProfile& profile = PROFILES[static_cast<int>(animalKind)];
+        x.push_back(startX);
+        y.push_back(0.0f);
+        dirX.push_back(directionX);
+        speed.push_back(profile.speed);
+        cruiseAltitude.push_back(profile.cruiseAltitude);
+        kind.push_back(animalKind);
+        label.push_back(internLabel(description));
+        return static_cast<Entity>(x.size() - 1);
+    }
+};
+
+// Same arithmetic as the overrides, but one loop for every kind of animal.
+// No branches and no calls: the compiler turns this into SIMD code.
+void movementSystem(World& world, float dt) {
+    const std::size_t count = world.size();
+    float* __restrict x = world.x.data();
+    float* __restrict y = world.y.data();
+    const float* __restrict dirX = world.dirX.data();
+    const float* __restrict speed = world.speed.data();
+    const float* __restrict cruise = world.cruiseAltitude.data();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        x[i] += dirX[i] * speed[i] * dt;
+        y[i] += (cruise[i] - y[i]) * CLIMB_RATE * dt;
+    }
+}
+
+void soundSystem(const World& world) {
+    for (std::size_t i = 0; i < world.size(); ++i) {
+        std::cout << PROFILES[static_cast<int>(world.kind[i])].sound << "\n";
+    }
+}
+
+void describeSystem(const World& world) {
+    static const char* const suffix[] = { " dog", " cat", "" };
+    for (std::size_t i = 0; i < world.size(); ++i) {
+        std::cout << "I am a " << world.labels[world.label[i]]
+                  << suffix[static_cast<int>(world.kind[i])] << "\n";
+    }
+}
+
+}  // namespace ecs
+
+// ---------------------------------------------------------------------------
+// Demo and benchmark
+// ---------------------------------------------------------------------------
+
+struct Spawn {
+    Kind kind;
+    const char* description;
+};
+
+const Spawn ZOO[] = {
+    { Kind::Dog, "Golden Retriever" },
+    { Kind::Cat, "Orange" },
+    { Kind::Bird, "Parrot" },
+    { Kind::Dog, "Husky" },
+    { Kind::Cat, "Black" },
+};
+
+float startX(std::size_t i) { return static_cast<float>(i % 1000); }
+float direction(std::size_t i) { return (i % 2 == 0) ? 1.0f : -1.0f; }
+
+std::vector<std::unique_ptr<oop::Animal>> buildObjects(std::size_t count) {
+    std::vector<std::unique_ptr<oop::Animal>> animals;
+    animals.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Spawn& s = ZOO[i % 5];
+        switch (s.kind) {
+            case Kind::Dog:
+                animals.push_back(std::make_unique<oop::Dog>(s.description, startX(i), direction(i)));
+                break;
+            case Kind::Cat:
+                animals.push_back(std::make_unique<oop::Cat>(s.description, startX(i), direction(i)));
+                break;
+            case Kind::Bird:
+                animals.push_back(std::make_unique<oop::Bird>(s.description, startX(i), direction(i)));
+                break;
+        }
+    }
+    return animals;
+}
+
+ecs::World buildWorld(std::size_t count) {
+    ecs::World world;
+    world.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        world.spawn(ZOO[i % 5].kind, ZOO[i % 5].description, startX(i), direction(i));
+    }
+    return world;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "=== ECS: behaviour as data ===\n";
+    ecs::World zoo = buildWorld(5);
+    ecs::describeSystem(zoo);
+    ecs::soundSystem(zoo);
+    for (int i = 0; i < 10; ++i) {
+        ecs::movementSystem(zoo, 0.1f);
+    }
+    std::cout << "Bird after 1s: x=" << zoo.x[2] << " altitude=" << zoo.y[2] << "\n";
+
+    // Usage: polymorphism_07_ecs [animals]
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1'000'000;
+    constexpr int TICKS = 50;
+    constexpr float DT = 1.0f / 60.0f;
+
+    std::cout << "\n=== " << count << " animals, " << TICKS << " ticks ===\n";
+
+    auto animals = buildObjects(count);
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < TICKS; ++tick) {
+        for (auto& animal : animals) {
+            animal->move(DT);
+        }
+    }
+    double virtualSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ecs::World world = buildWorld(count);
+    start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < TICKS; ++tick) {
+        ecs::movementSystem(world, DT);
+    }
+    double ecsSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Both versions must end in the same state. Allow rounding noise:
+    // the compiler may fuse multiply-adds differently in the two loops.
+    bool same = true;
+    for (std::size_t i = 0; i < count; ++i) {
+        same = same && std::fabs(animals[i]->getX() - world.x[i]) < 1e-3f &&
+               std::fabs(animals[i]->getY() - world.y[i]) < 1e-3f;
+    }
+
+    double updates = static_cast<double>(count) * TICKS;
+    std::cout << "Virtual hierarchy: " << static_cast<long long>(updates / virtualSeconds) << " updates/s\n";
+    std::cout << "ECS:               " << static_cast<long long>(updates / ecsSeconds) << " updates/s\n";
+    std::cout << "Same positions: " << std::boolalpha << same << "\n";
+
+    return same ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "payment_processors.h"
+#include "processor_registry.h"
+
+using polymorphism::ApplePayProcessor;
+using polymorphism::CreditCardProcessor;
+using polymorphism::PaymentProcessor;
+using polymorphism::PaymentProcessors;
+using polymorphism::PayPalProcessor;
+
+// Example: Choosing a payment processor by name, with a compile-time table
+//
+// main() in 02_payment_processors.cpp used to pick a processor with a
+// switch on an integer, so every new processor meant editing that switch.
+// It now asks the registry in processor_registry.h by name instead.
+//
+// The usual way to build such a registry is a std::unordered_map filled at
+// startup, often from static initializers in each processor's file - which
+// costs time at startup and depends on the unspecified order in which those
+// initializers run. PaymentProcessors is a list of types instead: the name
+// table, the factories and a perfect hash over the names are computed by
+// the compiler, and a lookup is one hash and one string comparison.
+
+// ---------------------------------------------------------------------------
+// The conventional runtime registry, for comparison
+// ---------------------------------------------------------------------------
+
+using RuntimeRegistry = std::unordered_map<std::string, std::function<std::unique_ptr<PaymentProcessor>()>>;
+
+RuntimeRegistry buildRuntimeRegistry() {
+    RuntimeRegistry registry;
+    registry.emplace(std::string(CreditCardProcessor::NAME), [] { return std::make_unique<CreditCardProcessor>(); });
+    registry.emplace(std::string(PayPalProcessor::NAME), [] { return std::make_unique<PayPalProcessor>(); });
+    registry.emplace(std::string(ApplePayProcessor::NAME), [] { return std::make_unique<ApplePayProcessor>(); });
+    return registry;
+}
+
+int main() {
+    double orderTotal = 99.99;
+
+    std::cout << "=== Registered processors ===\n";
+    for (std::size_t i = 0; i < PaymentProcessors::size(); ++i) {
+        std::cout << "  " << PaymentProcessors::nameAt(i) << "\n";
+    }
+
+    // Selection by name - no switch to keep in sync
+    std::string choice = "PayPal Processor";
+    if (auto processor = PaymentProcessors::create(choice)) {
+        polymorphism::checkoutOrder(*processor, orderTotal);
+    }
+    if (!PaymentProcessors::create("Cash")) {
+        std::cout << "\nUnknown processor \"Cash\" rejected\n";
+    }
+
+    // Benchmark: names come in as std::string, as they would from input
+    constexpr int LOOKUPS = 2'000'000;
+    constexpr int ROUNDS = 5;
+    std::vector<std::string> queries;
+    for (std::size_t i = 0; i < PaymentProcessors::size(); ++i) {
+        queries.emplace_back(PaymentProcessors::nameAt(i));
+    }
+
+    std::cout << "\n=== " << LOOKUPS << " lookups, best of " << ROUNDS << " rounds ===\n";
+
+    // Rounds alternate so neither side gets all the warm caches; the
+    // fastest round of each counts
+    std::uintptr_t checksum = 0;
+    RuntimeRegistry runtime = buildRuntimeRegistry();
+    auto timeLookups = [&](auto lookup) {
+        auto start = std::chrono::steady_clock::now();
+        std::size_t next = 0;
+        for (int i = 0; i < LOOKUPS; ++i) {
+            checksum += lookup(queries[next]);
+            next = next + 1 == queries.size() ? 0 : next + 1;
+        }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    double tableSeconds = 1e9;
+    double mapSeconds = 1e9;
+    for (int round = 0; round < ROUNDS; ++round) {
+        tableSeconds = std::min(tableSeconds, timeLookups([](const std::string& name) {
+            return reinterpret_cast<std::uintptr_t>(PaymentProcessors::factory(name));
+        }));
+        mapSeconds = std::min(mapSeconds, timeLookups([&runtime](const std::string& name) {
+            return reinterpret_cast<std::uintptr_t>(&runtime.find(name)->second);
+        }));
+    }
+
+    std::cout << "Compile-time table: " << std::fixed << std::setprecision(1) << tableSeconds * 1e9 / LOOKUPS << " ns/lookup\n";
+    std::cout << "std::unordered_map: " << mapSeconds * 1e9 / LOOKUPS << " ns/lookup\n";
+
+    // Startup: the map must be built before first use; the constexpr table is not built at all
+    constexpr int BUILDS = 100'000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BUILDS; ++i) {
+        checksum += buildRuntimeRegistry().size();
+    }
+    double buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "\n=== Startup cost ===\n";
+    std::cout << "Compile-time table: 0 ns (table is in the binary's read-only data)\n";
+    std::cout << "std::unordered_map: " << buildSeconds * 1e9 / BUILDS << " ns to build\n";
+    std::cout << "(checksum " << checksum << ")\n";
+
+    return 0;
+}
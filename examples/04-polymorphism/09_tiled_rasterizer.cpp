@@ -0,0 +1,540 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "vtable_shapes.h"
+
+// Example: Shapes that really draw - a tiled, multi-threaded rasterizer
+//
+// In 03_vtable_explanation.cpp, Shape::draw() and rotate() only print a
+// line. Here the same classes (vtable_shapes.h) do real work: every shape
+// gets a position, a size and an orientation, rotate() turns it and
+// draw(tile) fills its pixels into a framebuffer.
+//
+// Three ideas make 100,000 shapes per frame affordable:
+//   - Geometry lives in one array per field, so rotating every shape and
+//     computing their corners are plain loops the compiler vectorizes.
+//   - The screen is cut into 64x64 tiles. Each shape is added to the list
+//     ("bin") of every tile it overlaps.
+//   - Tiles are independent, so threads take them one at a time and call
+//     draw() for the shapes in that tile's bin, in the original order. The
+//     picture is the same for any number of threads.
+
+constexpr float PI = 3.14159265358979f;
+
+struct Framebuffer {
+    int width;
+    int height;
+    std::vector<std::uint32_t> pixels;  // 0xRRGGBB, row by row
+
+    Framebuffer(int width, int height)
+        : width(width), height(height), pixels(static_cast<std::size_t>(width) * height) {}
+
+    std::uint32_t* row(int y) { return pixels.data() + static_cast<std::size_t>(y) * width; }
+    const std::uint32_t* row(int y) const { return pixels.data() + static_cast<std::size_t>(y) * width; }
+};
+
+// The part of the framebuffer one draw() call may touch: [x0, x1) x [y0, y1)
+struct Tile {
+    Framebuffer& target;
+    int x0, y0, x1, y1;
+};
+
+// ---------------------------------------------------------------------------
+// Geometry of all shapes, one array per field (structure of arrays)
+// ---------------------------------------------------------------------------
+
+// Every shape is a regular polygon around its center; a circle only uses
+// the center and radius. Orientation is kept as a rotation matrix
+// [cos -sin; sin cos], so rotating is a multiply instead of trigonometry.
+// Each multiply rounds a little, and over thousands of steps the matrix
+// would stop being a pure rotation and shapes would grow or shrink, so
+// every step scales it back to unit length.
+class Geometry {
+public:
+    static constexpr int MAX_VERTICES = 4;
+
+    std::vector<float> centerX, centerY, radius;
+    std::vector<float> cosAngle, sinAngle;
+    // Corners relative to the center before rotation, and on screen after
+    std::array<std::vector<float>, MAX_VERTICES> localX, localY;
+    std::array<std::vector<float>, MAX_VERTICES> screenX, screenY;
+
+    std::size_t size() const { return centerX.size(); }
+
+    // Adds a regular polygon with `sides` corners (at most MAX_VERTICES);
+    // unused corners repeat the last one
+    std::uint32_t add(float x, float y, float r, int sides, float startAngle) {
+        auto id = static_cast<std::uint32_t>(size());
+        centerX.push_back(x);
+        centerY.push_back(y);
+        radius.push_back(r);
+        cosAngle.push_back(1.0f);
+        sinAngle.push_back(0.0f);
+        for (int k = 0; k < MAX_VERTICES; ++k) {
+            float angle = startAngle + 2.0f * PI * static_cast<float>(std::min(k, sides - 1)) / static_cast<float>(sides);
+            localX[k].push_back(r * std::cos(angle));
+            localY[k].push_back(r * std::sin(angle));
+            screenX[k].push_back(0.0f);
+            screenY[k].push_back(0.0f);
+        }
+        return id;
+    }
+
+    // cos^2 + sin^2 stays within a few float roundings of 1, where one
+    // Newton step, 1/sqrt(n) ~ (3 - n) / 2, is exact to float precision.
+    // Unlike std::sqrt it has no error path, so loops over it vectorize.
+    static void rotateStep(float& cosA, float& sinA, float c, float s) {
+        float newCos = cosA * c - sinA * s;
+        float newSin = sinA * c + cosA * s;
+        float scale = 1.5f - 0.5f * (newCos * newCos + newSin * newSin);
+        cosA = newCos * scale;
+        sinA = newSin * scale;
+    }
+
+    // One shape
+    void rotate(std::uint32_t id, int degrees) {
+        float c = std::cos(static_cast<float>(degrees) * PI / 180.0f);
+        float s = std::sin(static_cast<float>(degrees) * PI / 180.0f);
+        rotateStep(cosAngle[id], sinAngle[id], c, s);
+    }
+
+    // Every shape at once: the same 2x2 matrix multiply in a branch-free
+    // loop, which the compiler turns into SIMD code
+    void rotateAll(int degrees) {
+        const float c = std::cos(static_cast<float>(degrees) * PI / 180.0f);
+        const float s = std::sin(static_cast<float>(degrees) * PI / 180.0f);
+        float* __restrict cosA = cosAngle.data();
+        float* __restrict sinA = sinAngle.data();
+        for (std::size_t i = 0; i < size(); ++i) {
+            rotateStep(cosA[i], sinA[i], c, s);
+        }
+    }
+
+    // screen = center + rotation * local, for every corner of every shape
+    void transformVertices() {
+        const std::size_t count = size();
+        const float* __restrict cx = centerX.data();
+        const float* __restrict cy = centerY.data();
+        const float* __restrict cosA = cosAngle.data();
+        const float* __restrict sinA = sinAngle.data();
+        for (int k = 0; k < MAX_VERTICES; ++k) {
+            const float* __restrict lx = localX[k].data();
+            const float* __restrict ly = localY[k].data();
+            float* __restrict sx = screenX[k].data();
+            float* __restrict sy = screenY[k].data();
+            for (std::size_t i = 0; i < count; ++i) {
+                sx[i] = cx[i] + cosA[i] * lx[i] - sinA[i] * ly[i];
+                sy[i] = cy[i] + sinA[i] * lx[i] + cosA[i] * ly[i];
+            }
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Pixel filling
+// ---------------------------------------------------------------------------
+
+// Fills the pixels whose centers lie inside the circle
+void fillCircle(const Tile& tile, float cx, float cy, float r, std::uint32_t color) {
+    int yStart = std::max(tile.y0, static_cast<int>(std::ceil(cy - r - 0.5f)));
+    int yEnd = std::min(tile.y1, static_cast<int>(std::floor(cy + r - 0.5f)) + 1);
+    for (int y = yStart; y < yEnd; ++y) {
+        float dy = static_cast<float>(y) + 0.5f - cy;
+        float halfWidth = std::sqrt(std::max(0.0f, r * r - dy * dy));
+        int xStart = std::max(tile.x0, static_cast<int>(std::ceil(cx - halfWidth - 0.5f)));
+        int xEnd = std::min(tile.x1, static_cast<int>(std::floor(cx + halfWidth - 0.5f)) + 1);
+        if (xStart < xEnd) {
+            std::uint32_t* row = tile.target.row(y);
+            std::fill(row + xStart, row + xEnd, color);
+        }
+    }
+}
+
+// Fills a convex polygon with counter-clockwise corners. A pixel is inside
+// when it is on the left of every edge. Along a row, each edge's "edge
+// function" grows or shrinks linearly, so every edge cuts the row at one
+// point and keeps either the part before or the part after it. Intersecting
+// those cuts gives the row's span without testing pixels one by one.
+void fillConvex(const Tile& tile, const float* xs, const float* ys, int count, std::uint32_t color) {
+    float minX = xs[0], maxX = xs[0], minY = ys[0], maxY = ys[0];
+    for (int k = 1; k < count; ++k) {
+        minX = std::min(minX, xs[k]);
+        maxX = std::max(maxX, xs[k]);
+        minY = std::min(minY, ys[k]);
+        maxY = std::max(maxY, ys[k]);
+    }
+    int xStart = std::max(tile.x0, static_cast<int>(std::floor(minX)));
+    int xEnd = std::min(tile.x1, static_cast<int>(std::ceil(maxX)));
+    int yStart = std::max(tile.y0, static_cast<int>(std::floor(minY)));
+    int yEnd = std::min(tile.y1, static_cast<int>(std::ceil(maxY)));
+    if (xStart >= xEnd) {
+        return;
+    }
+
+    // E(p) = (b - a) x (p - a) for each edge a -> b, written as
+    // origin + stepX * p.x + stepY * p.y
+    float stepX[Geometry::MAX_VERTICES], stepY[Geometry::MAX_VERTICES], origin[Geometry::MAX_VERTICES];
+    for (int k = 0; k < count; ++k) {
+        int next = (k + 1) % count;
+        float dx = xs[next] - xs[k];
+        float dy = ys[next] - ys[k];
+        stepX[k] = -dy;
+        stepY[k] = dx;
+        origin[k] = dy * xs[k] - dx * ys[k];
+    }
+
+    const float firstX = static_cast<float>(xStart) + 0.5f;
+    const float width = static_cast<float>(xEnd - xStart);
+    for (int y = yStart; y < yEnd; ++y) {
+        float py = static_cast<float>(y) + 0.5f;
+        // Pixels i = 0 .. width-1 of this row are inside where
+        // edge + stepX * i >= 0 holds for every edge
+        float low = 0.0f, high = width;
+        for (int k = 0; k < count; ++k) {
+            float edge = origin[k] + stepX[k] * firstX + stepY[k] * py;
+            if (stepX[k] > 0.0f) {
+                low = std::max(low, std::ceil(-edge / stepX[k]));
+            } else if (stepX[k] < 0.0f) {
+                high = std::min(high, std::floor(edge / -stepX[k]) + 1.0f);
+            } else if (edge < 0.0f) {
+                high = 0.0f;
+            }
+        }
+        if (low < high) {
+            std::uint32_t* row = tile.target.row(y) + xStart;
+            std::fill(row + static_cast<int>(low), row + static_cast<int>(high), color);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// The shapes from 03_vtable_explanation.cpp, now with geometry
+// ---------------------------------------------------------------------------
+
+// What a shape needs to fill pixels. polymorphism::Shape stays as it is;
+// each shape below derives from its class in vtable_shapes.h and from
+// Raster, and overrides rotate() to turn its geometry instead of printing.
+// rotate() is const in Shape: the geometry it changes lives in the scene,
+// not in the shape object.
+class Raster {
+protected:
+    Geometry& geometry;
+    std::uint32_t id;  // this shape's index in the geometry arrays
+    std::uint32_t color;
+
+    // Screen corners of this shape, as produced by transformVertices()
+    void corners(float* xs, float* ys) const {
+        for (int k = 0; k < Geometry::MAX_VERTICES; ++k) {
+            xs[k] = geometry.screenX[k][id];
+            ys[k] = geometry.screenY[k][id];
+        }
+    }
+
+public:
+    Raster(Geometry& geometry, std::uint32_t id, std::uint32_t color)
+        : geometry(geometry), id(id), color(color) {}
+    virtual ~Raster() = default;
+
+    // Draws the part of the shape that falls inside `tile`
+    virtual void draw(const Tile& tile) const = 0;
+
+    // Conservative screen bounds, used to sort shapes into tiles
+    float minX() const { return geometry.centerX[id] - geometry.radius[id]; }
+    float maxX() const { return geometry.centerX[id] + geometry.radius[id]; }
+    float minY() const { return geometry.centerY[id] - geometry.radius[id]; }
+    float maxY() const { return geometry.centerY[id] + geometry.radius[id]; }
+};
+
+class Circle : public polymorphism::Circle, public Raster {
+public:
+    Circle(Geometry& geometry, float x, float y, float r, std::uint32_t color)
+        : Raster(geometry, geometry.add(x, y, r, 1, 0.0f), color) {}
+
+    using polymorphism::Circle::draw;  // the printing draw() is still there
+
+    void draw(const Tile& tile) const override {
+        fillCircle(tile, geometry.centerX[id], geometry.centerY[id], geometry.radius[id], color);
+    }
+
+    // Rotation has no visual effect on a circle
+    void rotate(int) const override {}
+};
+
+class Square : public polymorphism::Square, public Raster {
+public:
+    // `halfSize` is half the side length
+    Square(Geometry& geometry, float x, float y, float halfSize, std::uint32_t color)
+        : Raster(geometry, geometry.add(x, y, halfSize * std::sqrt(2.0f), 4, PI / 4.0f), color) {}
+
+    using polymorphism::Square::draw;
+
+    void draw(const Tile& tile) const override {
+        float xs[Geometry::MAX_VERTICES], ys[Geometry::MAX_VERTICES];
+        corners(xs, ys);
+        fillConvex(tile, xs, ys, 4, color);
+    }
+
+    void rotate(int degrees) const override { geometry.rotate(id, degrees); }
+};
+
+class Triangle : public polymorphism::Triangle, public Raster {
+public:
+    // Equilateral, pointing up on screen
+    Triangle(Geometry& geometry, float x, float y, float r, std::uint32_t color)
+        : Raster(geometry, geometry.add(x, y, r, 3, -PI / 2.0f), color) {}
+
+    using polymorphism::Triangle::draw;
+
+    void draw(const Tile& tile) const override {
+        float xs[Geometry::MAX_VERTICES], ys[Geometry::MAX_VERTICES];
+        corners(xs, ys);
+        fillConvex(tile, xs, ys, 3, color);
+    }
+
+    void rotate(int degrees) const override { geometry.rotate(id, degrees); }
+};
+
+// ---------------------------------------------------------------------------
+// Scene: owns the shapes and renders them tile by tile
+// ---------------------------------------------------------------------------
+
+constexpr std::uint32_t BACKGROUND = 0x1E1E28;
+constexpr std::uint32_t CIRCLE_COLOR = 0xE74C3C;
+constexpr std::uint32_t SQUARE_COLOR = 0x3498DB;
+constexpr std::uint32_t TRIANGLE_COLOR = 0x2ECC71;
+
+class Scene {
+private:
+    static constexpr int TILE_SIZE = 64;
+
+    Geometry geometry;
+    std::vector<std::unique_ptr<polymorphism::Shape>> shapes;
+    std::vector<const Raster*> rasters;  // the same shapes, as drawn
+    std::vector<std::vector<const Raster*>> bins;  // shapes overlapping each tile, in draw order
+    int tilesX = 0, tilesY = 0;
+
+    void binShapes(const Framebuffer& target) {
+        tilesX = (target.width + TILE_SIZE - 1) / TILE_SIZE;
+        tilesY = (target.height + TILE_SIZE - 1) / TILE_SIZE;
+        bins.resize(static_cast<std::size_t>(tilesX) * tilesY);
+        for (auto& bin : bins) {
+            bin.clear();  // keeps the capacity from the previous frame
+        }
+        for (const Raster* shape : rasters) {
+            int tx0 = std::max(0, static_cast<int>(std::floor(shape->minX())) / TILE_SIZE);
+            int ty0 = std::max(0, static_cast<int>(std::floor(shape->minY())) / TILE_SIZE);
+            int tx1 = std::min(tilesX - 1, static_cast<int>(std::floor(shape->maxX())) / TILE_SIZE);
+            int ty1 = std::min(tilesY - 1, static_cast<int>(std::floor(shape->maxY())) / TILE_SIZE);
+            for (int ty = ty0; ty <= ty1; ++ty) {
+                for (int tx = tx0; tx <= tx1; ++tx) {
+                    bins[static_cast<std::size_t>(ty) * tilesX + tx].push_back(shape);
+                }
+            }
+        }
+    }
+
+    void renderTile(std::size_t index, Framebuffer& target) const {
+        int tx = static_cast<int>(index % tilesX);
+        int ty = static_cast<int>(index / tilesX);
+        Tile tile{target, tx * TILE_SIZE, ty * TILE_SIZE,
+                  std::min(target.width, (tx + 1) * TILE_SIZE),
+                  std::min(target.height, (ty + 1) * TILE_SIZE)};
+        for (int y = tile.y0; y < tile.y1; ++y) {
+            std::fill(target.row(y) + tile.x0, target.row(y) + tile.x1, BACKGROUND);
+        }
+        for (const Raster* shape : bins[index]) {
+            shape->draw(tile);
+        }
+    }
+
+    template <typename T>
+    polymorphism::Shape& add(std::unique_ptr<T> shape) {
+        rasters.push_back(shape.get());
+        shapes.push_back(std::move(shape));
+        return *shapes.back();
+    }
+
+public:
+    Scene() = default;
+
+    // Every shape holds a Geometry& into this scene, so a copied or moved
+    // Scene would leave its shapes pointing at the original's geometry
+    Scene(const Scene&) = delete;
+    Scene& operator=(const Scene&) = delete;
+    Scene(Scene&&) = delete;
+    Scene& operator=(Scene&&) = delete;
+
+    polymorphism::Shape& addCircle(float x, float y, float r) {
+        return add(std::make_unique<Circle>(geometry, x, y, r, CIRCLE_COLOR));
+    }
+    polymorphism::Shape& addSquare(float x, float y, float halfSize) {
+        return add(std::make_unique<Square>(geometry, x, y, halfSize, SQUARE_COLOR));
+    }
+    polymorphism::Shape& addTriangle(float x, float y, float r) {
+        return add(std::make_unique<Triangle>(geometry, x, y, r, TRIANGLE_COLOR));
+    }
+
+    std::size_t size() const { return shapes.size(); }
+
+    // One virtual call per shape, as in 03_vtable_explanation.cpp
+    void rotateEach(int degrees) {
+        for (const auto& shape : shapes) {
+            shape->rotate(degrees);
+        }
+    }
+
+    // Circles are rotated too; their draw() ignores the orientation
+    void rotateAll(int degrees) { geometry.rotateAll(degrees); }
+
+    void render(Framebuffer& target, unsigned threads) {
+        geometry.transformVertices();
+        binShapes(target);
+
+        std::atomic<std::size_t> nextTile{0};
+        auto worker = [&] {
+            for (std::size_t index; (index = nextTile.fetch_add(1)) < bins.size();) {
+                renderTile(index, target);
+            }
+        };
+        std::vector<std::thread> pool;
+        for (unsigned i = 1; i < threads; ++i) {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : pool) {
+            thread.join();
+        }
+    }
+};
+
+// Binary PPM: a tiny header followed by raw RGB bytes
+bool writePpm(const Framebuffer& image, const std::string& path) {
+    std::ofstream out(path, std::ios::binary);
+    out << "P6\n" << image.width << " " << image.height << "\n255\n";
+    std::vector<char> line(static_cast<std::size_t>(image.width) * 3);
+    for (int y = 0; y < image.height; ++y) {
+        const std::uint32_t* row = image.row(y);
+        for (int x = 0; x < image.width; ++x) {
+            line[3 * x] = static_cast<char>(row[x] >> 16);
+            line[3 * x + 1] = static_cast<char>(row[x] >> 8);
+            line[3 * x + 2] = static_cast<char>(row[x]);
+        }
+        out.write(line.data(), static_cast<std::streamsize>(line.size()));
+    }
+    return static_cast<bool>(out);
+}
+
+// Two characters per pixel, since terminal cells are about twice as tall as wide
+void printAscii(const Framebuffer& image) {
+    for (int y = 0; y < image.height; ++y) {
+        for (int x = 0; x < image.width; ++x) {
+            switch (image.row(y)[x]) {
+                case CIRCLE_COLOR: std::cout << "()"; break;
+                case SQUARE_COLOR: std::cout << "##"; break;
+                case TRIANGLE_COLOR: std::cout << "/\\"; break;
+                default: std::cout << " ."; break;
+            }
+        }
+        std::cout << "\n";
+    }
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "=== Drawing all shapes ===\n";
+    {
+        Scene scene;
+        polymorphism::Shape* shapes[3] = {&scene.addCircle(7.0f, 8.0f, 6.0f),
+                            &scene.addSquare(20.0f, 8.0f, 5.0f),
+                            &scene.addTriangle(33.0f, 9.0f, 7.0f)};
+        Framebuffer canvas(40, 16);
+        scene.render(canvas, 1);
+        printAscii(canvas);
+
+        std::cout << "\n=== Rotating all shapes by 45 degrees ===\n";
+        for (polymorphism::Shape* shape : shapes) {
+            shape->rotate(45);  // Virtual call - looks up in vtable
+        }
+        scene.render(canvas, 1);
+        printAscii(canvas);
+    }
+
+    // Usage: polymorphism_09_rasterizer [shapes] [frames] [output.ppm]
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100'000;
+    int frames = argc > 2 ? std::stoi(argv[2]) : 5;
+    std::string outputPath = argc > 3 ? argv[3] : "shapes.ppm";
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    Scene scene;
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> xPosition(0.0f, 1920.0f);
+    std::uniform_real_distribution<float> yPosition(0.0f, 1080.0f);
+    std::uniform_real_distribution<float> size(3.0f, 12.0f);
+    for (std::size_t i = 0; i < count; ++i) {
+        float x = xPosition(random), y = yPosition(random), r = size(random);
+        switch (i % 3) {
+            case 0: scene.addCircle(x, y, r); break;
+            case 1: scene.addSquare(x, y, r * 0.8f); break;
+            default: scene.addTriangle(x, y, r); break;
+        }
+    }
+
+    std::cout << "\n=== " << count << " shapes at 1920x1080, " << threads << " thread(s) ===\n";
+
+    constexpr int ROTATIONS = 100;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ROTATIONS; ++i) {
+        scene.rotateEach(1);
+    }
+    double eachSeconds = secondsSince(start) / ROTATIONS;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ROTATIONS; ++i) {
+        scene.rotateAll(1);
+    }
+    double batchSeconds = secondsSince(start) / ROTATIONS;
+    std::cout << "rotate() per shape:  " << eachSeconds * 1e3 << " ms for all shapes\n";
+    std::cout << "Batched rotateAll(): " << batchSeconds * 1e3 << " ms for all shapes\n";
+
+    Framebuffer frame(1920, 1080);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; ++i) {
+        scene.rotateAll(3);
+        scene.render(frame, threads);
+    }
+    double frameSeconds = secondsSince(start) / frames;
+    std::cout << "Frame time:          " << frameSeconds * 1e3 << " ms (" << 1.0 / frameSeconds
+              << " frames/s)\n";
+
+    // The tiles must not depend on each other: any thread count gives the same picture
+    Framebuffer single(1920, 1080);
+    scene.render(single, 1);
+    scene.render(frame, 4);
+    if (single.pixels != frame.pixels) {
+        std::cout << "Frames rendered with 1 and 4 threads differ!\n";
+        return 1;
+    }
+    std::cout << "1-thread and 4-thread frames are identical\n";
+
+    if (writePpm(frame, outputPath)) {
+        std::cout << "Wrote " << outputPath << "\n";
+    } else {
+        std::cout << "Could not write " << outputPath << "\n";
+    }
+
+    return 0;
+}
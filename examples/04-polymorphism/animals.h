@@ -0,0 +1,93 @@
+#pragma once
+
+#include <iostream>
+#include <string_view>
+
+#include "../common/interned_string.h"
+#include "../common/layout_fields.h"
+
+// Animal hierarchy from 01_animal_example.cpp.
+
+namespace polymorphism {
+
+// Breeds, colors and species repeat across many animals, so they are
+// interned (common/interned_string.h): 4 bytes per object, no heap
+
+// Base class with virtual functions
+class Animal {
+public:
+    virtual ~Animal() = default;
+    
+    virtual void makeSound() const {
+        std::cout << "Generic animal sound\n";
+    }
+    
+    virtual void move() const = 0;
+    
+    virtual void describe() const = 0;
+};
+
+class Dog : public Animal {
+private:
+    InternedString breed;
+    LAYOUT_FIELDS(Dog, breed)
+    
+public:
+    Dog(std::string_view breed) : breed(breed) {}
+    
+    void makeSound() const override {
+        std::cout << "Woof! Woof!\n";
+    }
+    
+    void move() const override {
+        std::cout << "Running on four legs\n";
+    }
+    
+    void describe() const override {
+        std::cout << "I am a " << breed << " dog\n";
+    }
+};
+
+class Cat : public Animal {
+private:
+    InternedString color;
+    LAYOUT_FIELDS(Cat, color)
+    
+public:
+    Cat(std::string_view color) : color(color) {}
+    
+    void makeSound() const override {
+        std::cout << "Meow! Meow!\n";
+    }
+    
+    void move() const override {
+        std::cout << "Walking silently on four legs\n";
+    }
+    
+    void describe() const override {
+        std::cout << "I am a " << color << " cat\n";
+    }
+};
+
+class Bird : public Animal {
+private:
+    InternedString species;
+    LAYOUT_FIELDS(Bird, species)
+    
+public:
+    Bird(std::string_view species) : species(species) {}
+    
+    void makeSound() const override {
+        std::cout << "Tweet! Tweet!\n";
+    }
+    
+    void move() const override {
+        std::cout << "Flying in the sky\n";
+    }
+    
+    void describe() const override {
+        std::cout << "I am a " << species << "\n";
+    }
+};
+
+}  // namespace polymorphism
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+// Payment processors and checkoutOrder() from 02_payment_processors.cpp.
+// Each processor's NAME is what processor_registry.h finds it by.
+
+namespace polymorphism {
+
+// Abstract payment processor interface
+class PaymentProcessor {
+public:
+    virtual ~PaymentProcessor() = default;
+    
+    virtual bool process(double amount) = 0;
+    virtual void refund(double amount) = 0;
+    virtual const char* getProcessorName() const = 0;
+};
+
+// Credit card processor
+class CreditCardProcessor : public PaymentProcessor {
+public:
+    static constexpr std::string_view NAME = "Credit Card Processor";
+    
+    bool process(double amount) override {
+        std::cout << "Processing $" << std::fixed << std::setprecision(2) 
+                  << amount << " via credit card\n";
+        std::cout << "  Connecting to payment gateway...\n";
+        std::cout << "  Verifying card details...\n";
+        std::cout << "  Transaction approved!\n";
+        return true;
+    }
+    
+    void refund(double amount) override {
+        std::cout << "Refunding $" << std::fixed << std::setprecision(2) 
+                  << amount << " to credit card\n";
+    }
+    
+    const char* getProcessorName() const override {
+        return NAME.data();
+    }
+};
+
+// PayPal processor
+class PayPalProcessor : public PaymentProcessor {
+public:
+    static constexpr std::string_view NAME = "PayPal Processor";
+    
+    bool process(double amount) override {
+        std::cout << "Processing $" << std::fixed << std::setprecision(2) 
+                  << amount << " via PayPal\n";
+        std::cout << "  Authenticating PayPal account...\n";
+        std::cout << "  Transfer initiated...\n";
+        std::cout << "  Transaction completed!\n";
+        return true;
+    }
+    
+    void refund(double amount) override {
+        std::cout << "Refunding $" << std::fixed << std::setprecision(2) 
+                  << amount << " to PayPal account\n";
+    }
+    
+    const char* getProcessorName() const override {
+        return NAME.data();
+    }
+};
+
+// Apple Pay processor
+class ApplePayProcessor : public PaymentProcessor {
+public:
+    static constexpr std::string_view NAME = "Apple Pay Processor";
+    
+    bool process(double amount) override {
+        std::cout << "Processing $" << std::fixed << std::setprecision(2) 
+                  << amount << " via Apple Pay\n";
+        std::cout << "  Reading device biometric...\n";
+        std::cout << "  Sending secure payment token...\n";
+        std::cout << "  Transaction authorized!\n";
+        return true;
+    }
+    
+    void refund(double amount) override {
+        std::cout << "Refunding $" << std::fixed << std::setprecision(2) 
+                  << amount << " via Apple Pay\n";
+    }
+    
+    const char* getProcessorName() const override {
+        return NAME.data();
+    }
+};
+
+// Generic checkout function - works with ANY payment processor
+inline void checkoutOrder(PaymentProcessor& processor, double cartTotal) {
+    std::cout << "\n=== Checkout Order ===\n";
+    std::cout << "Using: " << processor.getProcessorName() << std::endl;
+    std::cout << "Total: $" << std::fixed << std::setprecision(2) << cartTotal << std::endl;
+    std::cout << "\nProcessing payment...\n";
+    
+    if (processor.process(cartTotal)) {
+        std::cout << "✓ Order completed successfully!\n";
+    } else {
+        std::cout << "✗ Payment failed\n";
+    }
+}
+
+}  // namespace polymorphism
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "payment_processors.h"
+
+// Payment processors by name, from a table the compiler builds
+//
+// A registry maps names to factory functions, so picking a processor does
+// not need a switch that every new processor has to be added to. Here the
+// registry is a list of types: the name table, the factories and a perfect
+// hash over the names are all computed at compile time, so nothing runs
+// at startup. 02_payment_processors.cpp selects its processor through it;
+// 08_processor_registry.cpp shows how it works.
+
+namespace polymorphism {
+
+using ProcessorFactory = std::unique_ptr<PaymentProcessor> (*)();
+
+template <typename T>
+std::unique_ptr<PaymentProcessor> makeProcessor() {
+    return std::make_unique<T>();
+}
+
+// FNV-1a over every character, started from a seed
+constexpr std::uint32_t seededHash(std::string_view text, std::uint32_t seed) {
+    std::uint32_t hash = 2166136261u ^ seed;
+    for (char c : text) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+// Each processor type provides a static constexpr NAME
+template <typename... Processors>
+class ProcessorRegistry {
+private:
+    static constexpr std::size_t COUNT = sizeof...(Processors);
+
+    static constexpr std::array<std::string_view, COUNT> NAMES = { Processors::NAME... };
+    static constexpr std::array<ProcessorFactory, COUNT> FACTORIES = { &makeProcessor<Processors>... };
+
+    // Twice as many slots as names, rounded up to a power of two, so a
+    // collision-free seed is found after a few tries
+    static constexpr std::size_t tableSize() {
+        std::size_t size = 1;
+        while (size < 2 * COUNT) {
+            size *= 2;
+        }
+        return size;
+    }
+    static constexpr std::size_t SLOTS = tableSize();
+
+    // Try seeds until every name lands in its own slot. If none is found
+    // the throw turns into a compile error.
+    static constexpr std::uint32_t findSeed() {
+        for (std::uint32_t seed = 0; seed < 100'000; ++seed) {
+            std::array<bool, SLOTS> used{};
+            bool collision = false;
+            for (std::string_view name : NAMES) {
+                std::size_t slot = seededHash(name, seed) & (SLOTS - 1);
+                collision = collision || used[slot];
+                used[slot] = true;
+            }
+            if (!collision) {
+                return seed;
+            }
+        }
+        throw "no perfect hash seed found for the processor names";
+    }
+    static constexpr std::uint32_t SEED = findSeed();
+
+    // Index into NAMES for each slot; COUNT marks an empty slot
+    static constexpr std::array<std::size_t, SLOTS> buildSlots() {
+        std::array<std::size_t, SLOTS> slots{};
+        for (auto& slot : slots) {
+            slot = COUNT;
+        }
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            slots[seededHash(NAMES[i], SEED) & (SLOTS - 1)] = i;
+        }
+        return slots;
+    }
+    static constexpr std::array<std::size_t, SLOTS> SLOT_TABLE = buildSlots();
+
+public:
+    // Index of `name`, or size() if it is not registered. One hash, one
+    // string comparison.
+    static constexpr std::size_t indexOf(std::string_view name) {
+        std::size_t index = SLOT_TABLE[seededHash(name, SEED) & (SLOTS - 1)];
+        return index < COUNT && NAMES[index] == name ? index : COUNT;
+    }
+
+    static constexpr std::size_t size() { return COUNT; }
+    static constexpr std::string_view nameAt(std::size_t index) { return NAMES[index]; }
+
+    // Returns nullptr for an unknown name
+    static std::unique_ptr<PaymentProcessor> create(std::string_view name) {
+        std::size_t index = indexOf(name);
+        return index < COUNT ? FACTORIES[index]() : nullptr;
+    }
+
+    static ProcessorFactory factory(std::string_view name) {
+        std::size_t index = indexOf(name);
+        return index < COUNT ? FACTORIES[index] : nullptr;
+    }
+};
+
+// The one place a new processor has to be mentioned
+using PaymentProcessors = ProcessorRegistry<CreditCardProcessor, PayPalProcessor, ApplePayProcessor>;
+
+// The whole table exists before the program starts
+static_assert(PaymentProcessors::indexOf("PayPal Processor") == 1, "lookup runs at compile time");
+static_assert(PaymentProcessors::indexOf("Cash") == PaymentProcessors::size(), "unknown names are rejected");
+
+}  // namespace polymorphism
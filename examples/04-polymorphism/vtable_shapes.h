@@ -0,0 +1,50 @@
+#pragma once
+
+#include <iostream>
+
+// Shapes from 03_vtable_explanation.cpp.
+
+namespace polymorphism {
+
+class Shape {
+public:
+    virtual ~Shape() = default;
+    virtual void draw() const = 0;
+    virtual void rotate(int degrees) const = 0;
+};
+
+class Circle : public Shape {
+public:
+    void draw() const override {
+        std::cout << "Drawing circle\n";
+    }
+    
+    void rotate(int degrees) const override {
+        std::cout << "Rotating circle " << degrees << " degrees\n";
+        std::cout << "(Note: rotation has no visual effect on circle)\n";
+    }
+};
+
+class Square : public Shape {
+public:
+    void draw() const override {
+        std::cout << "Drawing square\n";
+    }
+    
+    void rotate(int degrees) const override {
+        std::cout << "Rotating square " << degrees << " degrees\n";
+    }
+};
+
+class Triangle : public Shape {
+public:
+    void draw() const override {
+        std::cout << "Drawing triangle\n";
+    }
+    
+    void rotate(int degrees) const override {
+        std::cout << "Rotating triangle " << degrees << " degrees\n";
+    }
+};
+
+}  // namespace polymorphism
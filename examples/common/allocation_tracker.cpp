@@ -0,0 +1,211 @@
+#include "allocation_tracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>  // _aligned_malloc, _aligned_free
+#endif
+
+// Replacement global operator new/delete. Every block gets a header in
+// front of it that remembers the requested size, so delete can keep the
+// live byte count exact without asking the C library.
+//
+// Reporting uses printf rather than iostreams: it must not allocate while
+// the counters are being read, and it also runs during static destruction.
+
+namespace {
+
+std::atomic<std::size_t> allocationCount{0};
+std::atomic<std::size_t> deallocationCount{0};
+std::atomic<std::size_t> totalBytes{0};
+std::atomic<std::size_t> live{0};
+std::atomic<std::size_t> peak{0};
+std::atomic<std::size_t> failedChecks{0};
+
+// Header size for a given alignment: big enough for the size field and a
+// multiple of the alignment, so the user pointer stays aligned
+constexpr std::size_t headerSize(std::size_t alignment) {
+    return std::max(alignment, alignof(std::max_align_t));
+}
+
+void* recordAllocation(void* block, std::size_t size, std::size_t alignment) {
+    char* user = static_cast<char*>(block) + headerSize(alignment);
+    *reinterpret_cast<std::size_t*>(user - sizeof(std::size_t)) = size;
+
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    totalBytes.fetch_add(size, std::memory_order_relaxed);
+    std::size_t now = live.fetch_add(size, std::memory_order_relaxed) + size;
+    std::size_t highest = peak.load(std::memory_order_relaxed);
+    while (now > highest && !peak.compare_exchange_weak(highest, now, std::memory_order_relaxed)) {
+    }
+    return user;
+}
+
+// Returns the start of the block that holds `user`
+void* recordDeallocation(void* user, std::size_t alignment) {
+    std::size_t size = *reinterpret_cast<std::size_t*>(static_cast<char*>(user) - sizeof(std::size_t));
+    deallocationCount.fetch_add(1, std::memory_order_relaxed);
+    live.fetch_sub(size, std::memory_order_relaxed);
+    return static_cast<char*>(user) - headerSize(alignment);
+}
+
+// Returns nullptr if the block cannot be allocated, including when the
+// header or the rounding would overflow size_t; allocateOrThrow turns that
+// into std::bad_alloc
+void* allocate(std::size_t size, std::size_t alignment) {
+    std::size_t header = headerSize(alignment);
+    std::size_t limit = std::numeric_limits<std::size_t>::max() - header;
+    if (alignment > alignof(std::max_align_t)) {
+        limit -= alignment - 1;  // room for rounding up to a multiple of the alignment
+    }
+    if (size > limit) {
+        return nullptr;
+    }
+    void* block = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        block = std::malloc(header + size);
+    } else {
+#if defined(_WIN32)
+        block = _aligned_malloc(header + size, alignment);
+#else
+        // aligned_alloc wants the size to be a multiple of the alignment
+        std::size_t rounded = (header + size + alignment - 1) / alignment * alignment;
+        block = std::aligned_alloc(alignment, rounded);
+#endif
+    }
+    return block == nullptr ? nullptr : recordAllocation(block, size, alignment);
+}
+
+void release(void* user, std::size_t alignment) {
+    if (user == nullptr) {
+        return;
+    }
+    void* block = recordDeallocation(user, alignment);
+#if defined(_WIN32)
+    if (alignment > alignof(std::max_align_t)) {
+        _aligned_free(block);
+        return;
+    }
+#endif
+    std::free(block);
+}
+
+void* allocateOrThrow(std::size_t size, std::size_t alignment) {
+    // new must return a unique pointer even for zero bytes
+    void* user = allocate(size == 0 ? 1 : size, alignment);
+    if (user == nullptr) {
+        throw std::bad_alloc();
+    }
+    return user;
+}
+
+void printStats(const char* name, const allocation::Stats& stats) {
+    std::fprintf(stderr, "%-28s %10zu allocs %10zu frees %12zu bytes %12zu peak\n", name,
+                 stats.allocations, stats.deallocations, stats.bytes, stats.peakBytes);
+}
+
+// Prints the whole-program totals once main() has returned
+struct ExitReport {
+    ~ExitReport() {
+        std::fprintf(stderr, "\n=== Allocation report ===\n");
+        printStats("whole program", allocation::total());
+    }
+} exitReport;
+
+}  // namespace
+
+void* operator new(std::size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size == 0 ? 1 : size, alignof(std::max_align_t));
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size == 0 ? 1 : size, alignof(std::max_align_t));
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { release(ptr, alignof(std::max_align_t)); }
+void operator delete[](void* ptr) noexcept { release(ptr, alignof(std::max_align_t)); }
+void operator delete(void* ptr, std::size_t) noexcept { release(ptr, alignof(std::max_align_t)); }
+void operator delete[](void* ptr, std::size_t) noexcept { release(ptr, alignof(std::max_align_t)); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { release(ptr, alignof(std::max_align_t)); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { release(ptr, alignof(std::max_align_t)); }
+void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+    release(ptr, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+    release(ptr, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    release(ptr, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    release(ptr, static_cast<std::size_t>(alignment));
+}
+
+namespace allocation {
+
+Stats total() {
+    Stats stats;
+    stats.allocations = allocationCount.load(std::memory_order_relaxed);
+    stats.deallocations = deallocationCount.load(std::memory_order_relaxed);
+    stats.bytes = totalBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = peak.load(std::memory_order_relaxed);
+    return stats;
+}
+
+std::size_t liveBytes() {
+    return live.load(std::memory_order_relaxed);
+}
+
+// The global peak is lowered to the current live bytes on entry, so it
+// tracks the peak inside this scope, and raised back on exit so the
+// enclosing scope (and the exit report) still see the overall peak
+Scope::Scope(const char* name)
+    : name(name), start(total()), startLive(liveBytes()), outerPeak(peak.exchange(startLive)) {}
+
+Scope::~Scope() {
+    std::size_t inner = peak.load(std::memory_order_relaxed);
+    peak.store(std::max(outerPeak, inner), std::memory_order_relaxed);
+}
+
+Stats Scope::stats() const {
+    Stats now = total();
+    Stats stats;
+    stats.allocations = now.allocations - start.allocations;
+    stats.deallocations = now.deallocations - start.deallocations;
+    stats.bytes = now.bytes - start.bytes;
+    stats.peakBytes = now.peakBytes > startLive ? now.peakBytes - startLive : 0;
+    return stats;
+}
+
+void Scope::report() const {
+    printStats(name, stats());
+}
+
+bool expectAtMost(const Scope& scope, std::size_t maxAllocations, const char* what) {
+    std::size_t allocations = scope.stats().allocations;
+    bool ok = allocations <= maxAllocations;
+    std::fprintf(stderr, "%s: %s (%zu allocations, budget %zu)\n", ok ? "PASS" : "FAIL", what,
+                 allocations, maxAllocations);
+    if (!ok) {
+        failedChecks.fetch_add(1, std::memory_order_relaxed);
+    }
+    return ok;
+}
+
+std::size_t failures() {
+    return failedChecks.load(std::memory_order_relaxed);
+}
+
+}  // namespace allocation
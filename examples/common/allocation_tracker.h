@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+
+// Allocation accounting for the examples
+//
+// Linking allocation_tracker.cpp into a program replaces the global
+// operator new/delete with versions that count every allocation, the
+// bytes requested and the peak number of live bytes. At exit the totals
+// for the whole program are printed to stderr.
+//
+// Scopes measure a piece of code:
+//
+//     allocation::Scope scope("1000 deposits");
+//     ... code ...
+//     scope.report();                                  // prints the numbers
+//     allocation::expectAtMost(scope, 0, "deposit");   // or checks a budget
+//
+// Checks that exceed their budget are counted by allocation::failures(),
+// so an example can return a nonzero exit code and fail its test.
+
+namespace allocation {
+
+struct Stats {
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    std::size_t bytes = 0;      // total bytes requested
+    std::size_t peakBytes = 0;  // highest number of live bytes
+};
+
+// Totals since the program started
+Stats total();
+
+// Live bytes right now
+std::size_t liveBytes();
+
+// Measures allocations between its construction and stats()/report().
+// Scopes may nest; the peak of an inner scope also counts for the outer one.
+class Scope {
+private:
+    const char* name;
+    Stats start;
+    std::size_t startLive;
+    std::size_t outerPeak;  // peak watermark saved on entry, restored on exit
+
+public:
+    explicit Scope(const char* name);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    const char* getName() const { return name; }
+
+    // peakBytes is relative to the live bytes when the scope started
+    Stats stats() const;
+    void report() const;
+};
+
+// Prints PASS/FAIL for "scope made at most maxAllocations allocations"
+bool expectAtMost(const Scope& scope, std::size_t maxAllocations, const char* what);
+
+// Number of failed expectAtMost() checks so far
+std::size_t failures();
+
+}  // namespace allocation
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+// emplace-style factory for the examples' polymorphic containers
+//
+// Builds a T in the container straight from its constructor arguments,
+// without a named temporary in between, and returns it as a T&:
+//
+//     std::vector<std::unique_ptr<Employee>> company;
+//     emplace<Engineer>(company, std::move(parsedName));
+//
+// The arguments are forwarded untouched, so with the by-value constructors
+// of the example classes a temporary name is moved, never copied
+// (03-inheritance/07_sink_constructors.cpp counts this).
+
+template <typename T, typename Base, typename... Args>
+T& emplace(std::vector<std::unique_ptr<Base>>& container, Args&&... args) {
+    container.push_back(std::make_unique<T>(std::forward<Args>(args)...));
+    return static_cast<T&>(*container.back());
+}
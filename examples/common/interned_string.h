@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Interned strings for text members that repeat across many objects
+//
+// StringInterner stores each distinct text once, for the whole program;
+// InternedString is a 4-byte ID into it that reads like a const string.
+// The Animal classes (02-encapsulation/animal.h, 04-polymorphism/animals.h)
+// use it for their text members; 02-encapsulation/03_string_interning.cpp
+// measures what that saves.
+
+// Process-wide table of distinct strings. Each text is stored once and
+// never freed, so views handed out stay valid for the whole program.
+class StringInterner {
+private:
+    mutable std::shared_mutex mutex;
+    std::deque<std::string> storage;  // deque never moves existing elements
+    std::unordered_map<std::string_view, std::uint32_t> ids;
+
+    StringInterner() {
+        intern("");  // ID 0 is the empty string, so default objects need no lookup
+    }
+
+public:
+    static StringInterner& instance() {
+        static StringInterner interner;
+        return interner;
+    }
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    std::uint32_t intern(std::string_view text) {
+        {
+            // Fast path: most texts are already known, readers share the lock
+            std::shared_lock lock(mutex);
+            auto it = ids.find(text);
+            if (it != ids.end()) {
+                return it->second;
+            }
+        }
+
+        std::unique_lock lock(mutex);
+        auto it = ids.find(text);  // another thread may have won the race
+        if (it != ids.end()) {
+            return it->second;
+        }
+        auto id = static_cast<std::uint32_t>(storage.size());
+        const std::string& stored = storage.emplace_back(text);
+        ids.emplace(stored, id);
+        return id;
+    }
+
+    std::string_view lookup(std::uint32_t id) const {
+        std::shared_lock lock(mutex);
+        return storage[id];
+    }
+
+    std::size_t size() const {
+        std::shared_lock lock(mutex);
+        return storage.size();
+    }
+};
+
+// A 4-byte handle that behaves like a read-only string
+class InternedString {
+private:
+    std::uint32_t id = 0;
+
+public:
+    InternedString() = default;
+    InternedString(const char* text) : InternedString(std::string_view(text)) {}
+    InternedString(const std::string& text) : InternedString(std::string_view(text)) {}
+    InternedString(std::string_view text) : id(StringInterner::instance().intern(text)) {}
+
+    std::string_view view() const { return StringInterner::instance().lookup(id); }
+    std::uint32_t getId() const { return id; }
+
+    // Equal texts always share an ID, so comparison never touches the characters
+    bool operator==(const InternedString& other) const { return id == other.id; }
+    bool operator!=(const InternedString& other) const { return id != other.id; }
+};
+
+inline std::ostream& operator<<(std::ostream& out, const InternedString& text) {
+    return out << text.view();
+}
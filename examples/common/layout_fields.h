@@ -0,0 +1,52 @@
+#pragma once
+
+// Member lists for 04-polymorphism/05_object_layout.cpp
+//
+// A class lists its data members right after declaring them:
+//
+//     std::string brand;
+//     int year;
+//     LAYOUT_FIELDS(Vehicle, brand, year)
+//
+// and a derived class names its base first, so the base members are
+// reported too:
+//
+//     int numberOfDoors;
+//     LAYOUT_DERIVED_FIELDS(Car, Vehicle, numberOfDoors)
+//
+// Both define a hidden friend layoutFields(object, visit), found by
+// argument-dependent lookup, that calls visit(className, memberName,
+// member) for each member. It adds nothing to the object and is only
+// instantiated by code that calls it. A derived class without members of
+// its own needs no list: lookup finds its base's. Up to 6 members.
+
+#define LAYOUT_VISIT(member) visit(owner, #member, self.member);
+
+// The extra expansion step is for the MSVC traditional preprocessor,
+// which passes __VA_ARGS__ on as a single argument otherwise
+#define LAYOUT_EXPAND(x) x
+#define LAYOUT_EACH_1(m) LAYOUT_VISIT(m)
+#define LAYOUT_EACH_2(m, ...) LAYOUT_VISIT(m) LAYOUT_EXPAND(LAYOUT_EACH_1(__VA_ARGS__))
+#define LAYOUT_EACH_3(m, ...) LAYOUT_VISIT(m) LAYOUT_EXPAND(LAYOUT_EACH_2(__VA_ARGS__))
+#define LAYOUT_EACH_4(m, ...) LAYOUT_VISIT(m) LAYOUT_EXPAND(LAYOUT_EACH_3(__VA_ARGS__))
+#define LAYOUT_EACH_5(m, ...) LAYOUT_VISIT(m) LAYOUT_EXPAND(LAYOUT_EACH_4(__VA_ARGS__))
+#define LAYOUT_EACH_6(m, ...) LAYOUT_VISIT(m) LAYOUT_EXPAND(LAYOUT_EACH_5(__VA_ARGS__))
+#define LAYOUT_PICK(_1, _2, _3, _4, _5, _6, NAME, ...) NAME
+#define LAYOUT_EACH(...)                                                                  \
+    LAYOUT_EXPAND(LAYOUT_PICK(__VA_ARGS__, LAYOUT_EACH_6, LAYOUT_EACH_5, LAYOUT_EACH_4, \
+                              LAYOUT_EACH_3, LAYOUT_EACH_2, LAYOUT_EACH_1, )(__VA_ARGS__))
+
+#define LAYOUT_FIELDS(Class, ...)                                  \
+    template <typename Visit>                                      \
+    friend void layoutFields(const Class& self, Visit& visit) {    \
+        const char* owner = #Class;                                \
+        LAYOUT_EACH(__VA_ARGS__)                                   \
+    }
+
+#define LAYOUT_DERIVED_FIELDS(Class, Base, ...)                    \
+    template <typename Visit>                                      \
+    friend void layoutFields(const Class& self, Visit& visit) {    \
+        layoutFields(static_cast<const Base&>(self), visit);       \
+        const char* owner = #Class;                                \
+        LAYOUT_EACH(__VA_ARGS__)                                   \
+    }
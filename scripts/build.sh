@@ -29,14 +29,29 @@ if [ $? -eq 0 ]; then
     echo "  ./abstraction_01_basic"
     echo "  ./abstraction_02_attributes"
     echo "  ./abstraction_03_abstract"
+    echo "  ./abstraction_04_packed_car"
     echo "  ./encapsulation_01_bank"
     echo "  ./encapsulation_02_access"
+    echo "  ./encapsulation_03_interning"
+    echo "  ./encapsulation_04_money"
+    echo "  ./encapsulation_05_wal"
     echo "  ./inheritance_01_basic"
     echo "  ./inheritance_02_virtual"
     echo "  ./inheritance_03_abstract"
+    echo "  ./inheritance_04_coroutines"
+    echo "  ./inheritance_05_callsites"
+    echo "  ./inheritance_05_callsites_off"
+    echo "  ./inheritance_06_directory"
+    echo "  ./inheritance_07_sink"
     echo "  ./polymorphism_01_animals"
     echo "  ./polymorphism_02_payment"
     echo "  ./polymorphism_03_vtables"
+    echo "  ./polymorphism_04_reconciliation"
+    echo "  ./polymorphism_05_layout"
+    echo "  ./polymorphism_06_pipeline"
+    echo "  ./polymorphism_07_ecs"
+    echo "  ./polymorphism_08_registry"
+    echo "  ./polymorphism_09_rasterizer"
 else
     echo "✗ Build failed!"
     exit 1